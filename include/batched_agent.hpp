@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+#include "mapped_ibf.hpp"
+
+/*! \brief Looks up a batch of values in an uncompressed interleaved ibf, in memory or mapped.
+ *  The agent of the ibf reads the positions of one value after the other, so every lookup waits for its cache misses.
+ *  Here the positions of all values of a batch are computed and prefetched first, before any word is read, so the
+ *  cache misses of the batch overlap. This matters for ibfs much larger than the cache.
+ */
+class batched_agent
+{
+public:
+    //!\brief Construct an agent for an ibf in memory.
+    explicit batched_agent(seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed> const & ibf) :
+        batched_agent{ibf.raw_data().data(), ibf.bin_count(), ibf.bin_size(), ibf.hash_function_count()}
+    {}
+
+    //!\brief Construct an agent for a mapped ibf.
+    explicit batched_agent(mapped_ibf const & ibf) :
+        batched_agent{ibf.data(), ibf.bin_count(), ibf.bin_size(), ibf.hash_function_count()}
+    {}
+
+    /*! \brief Construct an agent for the bit data of an ibf.
+     *  \param data       The bit data in the layout of seqan3::interleaved_bloom_filter.
+     *  \param bins       The number of bins.
+     *  \param bin_size   The number of bits per bin.
+     *  \param hash_count The number of hash functions.
+     */
+    batched_agent(uint64_t const * const data, size_t const bins, size_t const bin_size, size_t const hash_count) :
+        data{data},
+        words{(bins + 63) / 64},
+        hash_count{hash_count},
+        hash{bin_size, words * 64}
+    {}
+
+    //!\brief The number of words of the result per value.
+    size_t words_per_value() const noexcept
+    {
+        return words;
+    }
+
+    /*! \brief Determines, which bins contain the values.
+     *  \param values The values, e.g. the next hashes of one read or the hashes of several reads.
+     *  \returns The bins of the values, words_per_value() words per value, bin b of value i is bit b % 64 of word
+     *           i * words_per_value() + b / 64. The result is overwritten by the next call.
+     */
+    std::vector<uint64_t> const & bulk_contains(std::span<uint64_t const> const values)
+    {
+        positions.resize(values.size() * hash_count);
+        for (size_t v = 0; v < values.size(); ++v)
+        {
+            for (size_t i = 0; i < hash_count; ++i)
+            {
+                size_t const position = hash(values[v], i) / 64;
+                positions[v * hash_count + i] = position;
+                // A position has one bit per bin, with many bins it spans several cache lines.
+                for (size_t w = 0; w < words; w += 8)
+                    __builtin_prefetch(data + position + w);
+            }
+        }
+
+        result.resize(values.size() * words);
+        for (size_t v = 0; v < values.size(); ++v)
+        {
+            size_t const * const value_positions = positions.data() + v * hash_count;
+            for (size_t w = 0; w < words; ++w)
+            {
+                uint64_t hits{~uint64_t{}};
+                for (size_t i = 0; i < hash_count; ++i)
+                    hits &= data[value_positions[i] + w];
+                result[v * words + w] = hits;
+            }
+        }
+        return result;
+    }
+
+private:
+    //!\brief The bit data of the ibf.
+    uint64_t const * data{};
+    //!\brief The number of words per position.
+    size_t words{};
+    //!\brief The number of hash functions.
+    size_t hash_count{};
+    //!\brief The hash functions of the ibf.
+    ibf_hash hash{};
+    //!\brief The first word of every position of the current batch.
+    std::vector<size_t> positions{};
+    //!\brief The result of the last batch.
+    std::vector<uint64_t> result{};
+};
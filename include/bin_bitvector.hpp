@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*! \brief The bins, that contain a value, as returned by the agents of the indices of minions.
+ *  Like the seqan3::interleaved_bloom_filter::membership_agent::binning_bitvector, bin i is bit i % 64 of word i / 64
+ *  of raw_data(), so search_ibf reads the results of all indices the same way.
+ */
+class bin_bitvector
+{
+public:
+    bin_bitvector() = default;
+
+    //!\brief Construct a bitvector for the given number of bins, none of which is set.
+    explicit bin_bitvector(size_t const bins) :
+        data((bins + 63) / 64, 0)
+    {}
+
+    //!\brief The words of the bins.
+    std::vector<uint64_t> const & raw_data() const noexcept
+    {
+        return data;
+    }
+
+    //!\brief The words of the bins, which are written by the agent owning the bitvector.
+    std::vector<uint64_t> & raw_data() noexcept
+    {
+        return data;
+    }
+
+private:
+    //!\brief The bits of the bins.
+    std::vector<uint64_t> data{};
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+/*! \brief Counts for many bins, how often they were hit, e.g. by the results of bulk_contains of an IBF.
+ *  The counts are stored as vertical bit-planes: bit b of word w of plane p is bit p of the count of bin 64 * w + b.
+ *  Adding a word of hits is a ripple-carry addition over the planes, so 64 bins are counted with a few bitwise
+ *  operations. Planes are added, when a count needs more bits.
+ */
+class bit_sliced_counter
+{
+public:
+    bit_sliced_counter() = default;
+
+    /*! \brief Construct a counter, in which all counts are 0.
+     *  \param bins The number of bins.
+     */
+    explicit bit_sliced_counter(size_t const bins) :
+        bins{bins},
+        words{(bins + 63) / 64}
+    {}
+
+    //!\brief The number of bins.
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    //!\brief Sets all counts to 0, but keeps the memory of the planes.
+    void clear() noexcept
+    {
+        std::fill(planes.begin(), planes.begin() + plane_count * words, 0);
+        plane_count = 0;
+    }
+
+    /*! \brief Increases the count of every bin, whose bit is set, by one.
+     *  \param hits The bits of the bins, bin i is bit i % 64 of hits[i / 64]. Bits after the last bin must be 0.
+     */
+    void add(uint64_t const * hits)
+    {
+        add_words(hits, [] (size_t) { return ~uint64_t{}; });
+    }
+
+    /*! \brief Increases the count of every bin, whose bit is set in both the hits and the mask, by one.
+     *  \param hits The bits of the bins, bin i is bit i % 64 of hits[i / 64].
+     *  \param mask The bins to count, in the same layout. Words of the mask, that are 0, are skipped.
+     */
+    void add(uint64_t const * hits, uint64_t const * mask)
+    {
+        add_words(hits, [mask] (size_t const w) { return mask[w]; });
+    }
+
+    //!\brief The count of the given bin.
+    uint64_t count(size_t const bin) const noexcept
+    {
+        size_t const w = bin / 64;
+        size_t const b = bin % 64;
+        uint64_t result{};
+        for (size_t p = 0; p < plane_count; ++p)
+            result |= ((planes[p * words + w] >> b) & 1) << p;
+        return result;
+    }
+
+    /*! \brief Marks all bins, whose count is at least the threshold.
+     *  \param threshold The threshold.
+     *  \param result    Is resized to one bit per bin, bin i is bit i % 64 of result[i / 64].
+     */
+    void greater_equal(uint64_t const threshold, std::vector<uint64_t> & result) const
+    {
+        result.assign(words, 0);
+        for (size_t w = 0; w < words; ++w)
+            result[w] = greater_equal_word(w, threshold);
+        mask_last_word(result);
+    }
+
+    /*! \brief Marks all bins, that are not decided yet: Their count is below the threshold, but can still reach it.
+     *  \param threshold The threshold.
+     *  \param remaining How many more times each count can be increased at most.
+     *  \param result    Is resized to one bit per bin, bin i is bit i % 64 of result[i / 64].
+     *  \returns Whether there is any undecided bin.
+     */
+    bool undecided(uint64_t const threshold, uint64_t const remaining, std::vector<uint64_t> & result) const
+    {
+        uint64_t const reachable = remaining >= threshold ? 0 : threshold - remaining;
+        uint64_t any{};
+        result.assign(words, 0);
+        for (size_t w = 0; w < words; ++w)
+            result[w] = greater_equal_word(w, reachable) & ~greater_equal_word(w, threshold);
+        mask_last_word(result);
+        for (uint64_t const word : result)
+            any |= word;
+        return any != 0;
+    }
+
+private:
+    //!\brief The number of bins.
+    size_t bins{};
+    //!\brief The number of words per plane.
+    size_t words{};
+    //!\brief The number of planes in use.
+    size_t plane_count{};
+    //!\brief The planes one after another, plane p starts at p * words.
+    std::vector<uint64_t> planes{};
+
+    //!\brief Adds the hits of all words, restricted to the mask returned by mask_of(w).
+    template <typename mask_fn_t>
+    void add_words(uint64_t const * hits, mask_fn_t && mask_of)
+    {
+        for (size_t w = 0; w < words; ++w)
+        {
+            uint64_t carry = hits[w] & mask_of(w);
+            for (size_t p = 0; carry != 0 && p < plane_count; ++p)
+            {
+                uint64_t & plane = planes[p * words + w];
+                uint64_t const next_carry = plane & carry;
+                plane ^= carry;
+                carry = next_carry;
+            }
+
+            if (carry != 0)
+            {
+                // Planes from plane_count on are 0, so the carry is stored as is in a new plane.
+                if (planes.size() == plane_count * words)
+                    planes.resize(planes.size() + words, 0);
+                planes[plane_count * words + w] = carry;
+                ++plane_count;
+            }
+        }
+    }
+
+    //!\brief The bins of word w, whose count is at least the threshold, comparing the planes from the highest bit on.
+    uint64_t greater_equal_word(size_t const w, uint64_t const threshold) const noexcept
+    {
+        uint64_t greater{};
+        uint64_t equal{~uint64_t{}};
+        for (size_t p = std::max<size_t>(plane_count, std::bit_width(threshold)); p-- > 0;)
+        {
+            uint64_t const plane = p < plane_count ? planes[p * words + w] : 0;
+            if ((threshold >> p) & 1)
+            {
+                equal &= plane;
+            }
+            else
+            {
+                greater |= equal & plane;
+                equal &= ~plane;
+            }
+        }
+        return greater | equal;
+    }
+
+    //!\brief Clears the bits after the last bin.
+    void mask_last_word(std::vector<uint64_t> & result) const noexcept
+    {
+        if (bins % 64 != 0)
+            result.back() &= (uint64_t{1} << (bins % 64)) - 1;
+    }
+};
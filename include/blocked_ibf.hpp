@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+#include "bin_bitvector.hpp"
+#include "shared.hpp"
+
+/*! \brief An interleaved Bloom filter, in which all hash functions of a value hit the same cache line per 64 bins.
+ *  As in seqan3::interleaved_bloom_filter, bit b of a position belongs to bin b, so a word holds one position of 64
+ *  bins. The positions are grouped into blocks of 8 words, i.e. 64 bytes. A value is hashed once to a block and to
+ *  hash_function_count distinct words in the block. A query reads one block per 64 bins, the blocks of all bins lie
+ *  next to each other, instead of hash_function_count random positions. A bin has only 8 bits per block, so for the
+ *  same size the false positive rate is higher than the one of the interleaved Bloom filter, see
+ *  blocked_false_positive_rate.
+ */
+class blocked_ibf
+{
+public:
+    //!\brief The number of words per block.
+    static constexpr size_t block_words{8};
+
+    blocked_ibf() = default;
+
+    /*! \brief Construct an empty blocked ibf, with the parameters of seqan3::interleaved_bloom_filter.
+     *  \param bins_       The number of bins.
+     *  \param size        The number of bits per bin, rounded up to a multiple of the words per block.
+     *  \param hash_count  The number of hash functions, between 1 and 5.
+     *  \throws std::logic_error, if a parameter is out of range.
+     */
+    blocked_ibf(seqan3::bin_count bins_, seqan3::bin_size size, seqan3::hash_function_count hash_count) :
+        bins{bins_.get()},
+        hash_functions{hash_count.get()},
+        groups{(bins + 63) / 64},
+        blocks{(size.get() + block_words - 1) / block_words}
+    {
+        if (bins == 0 || blocks == 0)
+            throw std::logic_error{"The number of bins and the bin size must be positive."};
+        if (hash_functions == 0 || hash_functions > 5)
+            throw std::logic_error{"The number of hash functions must be between 1 and 5."};
+        data.assign(blocks * groups * block_words, 0);
+    }
+
+    /*! \brief Inserts a value into a bin. The bits are set with atomic or, so several threads can insert at once, also
+     *  into bins sharing a word.
+     *  \param value The value.
+     *  \param bin   The bin.
+     */
+    void emplace(uint64_t const value, seqan3::bin_index const bin) noexcept
+    {
+        uint64_t const hash = murmur_mix(value);
+        uint64_t * const block = data.data() + block_of(hash, bin.get() / 64);
+        uint64_t const bit = uint64_t{1} << (bin.get() % 64);
+        for (uint64_t words = words_of(hash); words != 0; words &= words - 1)
+            std::atomic_ref<uint64_t>{block[std::countr_zero(words)]}.fetch_or(bit, std::memory_order_relaxed);
+    }
+
+    //!\brief The number of bins.
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    //!\brief The number of bits per bin.
+    size_t bin_size() const noexcept
+    {
+        return blocks * block_words;
+    }
+
+    //!\brief The number of hash functions.
+    size_t hash_function_count() const noexcept
+    {
+        return hash_functions;
+    }
+
+    //!\brief Answers single and batched queries, it reuses its buffers, so it must not be shared by threads.
+    class membership_agent_type
+    {
+    public:
+        //!\brief Construct an agent for the given blocked ibf.
+        explicit membership_agent_type(blocked_ibf const & ibf) :
+            ibf{&ibf},
+            result{ibf.bin_count()}
+        {}
+
+        /*! \brief Determines, which bins contain the value.
+         *  \param value The value.
+         *  \returns A reference to the result, which is overwritten by the next query.
+         */
+        bin_bitvector const & bulk_contains(uint64_t const value) noexcept
+        {
+            uint64_t const hash = murmur_mix(value);
+            test(ibf->data.data() + ibf->block_of(hash, 0), ibf->words_of(hash), result.raw_data().data());
+            return result;
+        }
+
+        /*! \brief Determines, which bins contain the values. The blocks of all values are prefetched first, so their
+         *         cache misses overlap.
+         *  \param values The values, e.g. the next hashes of one read or the hashes of several reads.
+         *  \returns The bins of the values, one word per 64 bins and value, bin b of value i is bit b % 64 of word
+         *           i * (bin_count() + 63) / 64 + b / 64. The result is overwritten by the next call.
+         */
+        std::vector<uint64_t> const & bulk_contains(std::span<uint64_t const> const values)
+        {
+            size_t const groups = ibf->groups;
+            blocks.resize(values.size());
+            for (size_t v = 0; v < values.size(); ++v)
+            {
+                uint64_t const hash = murmur_mix(values[v]);
+                blocks[v] = {ibf->data.data() + ibf->block_of(hash, 0), ibf->words_of(hash)};
+                for (size_t group = 0; group < groups; ++group)
+                    __builtin_prefetch(blocks[v].first + group * block_words);
+            }
+
+            batch_result.resize(values.size() * groups);
+            for (size_t v = 0; v < values.size(); ++v)
+                test(blocks[v].first, blocks[v].second, batch_result.data() + v * groups);
+            return batch_result;
+        }
+
+    private:
+        //!\brief The blocked ibf.
+        blocked_ibf const * ibf{};
+        //!\brief The result of the last query.
+        bin_bitvector result{};
+        //!\brief The first block and the words in the blocks of every value of the current batch.
+        std::vector<std::pair<uint64_t const *, uint64_t>> blocks{};
+        //!\brief The result of the last batch.
+        std::vector<uint64_t> batch_result{};
+
+        //!\brief Tests the blocks of a value in all groups, starting at first, and writes one word per group.
+        void test(uint64_t const * const first, uint64_t const words, uint64_t * const hits) const noexcept
+        {
+            // The words of a block, that no hash function hits, are ignored by setting all their bits. Then a block is
+            // tested with the same operations on all its 8 words, which the compiler turns into vector instructions.
+            std::array<uint64_t, block_words> ignored{};
+            for (size_t w = 0; w < block_words; ++w)
+                ignored[w] = ((words >> w) & 1) - 1;
+
+            for (size_t group = 0; group < ibf->groups; ++group)
+            {
+                uint64_t const * const block = first + group * block_words;
+                uint64_t group_hits{~uint64_t{}};
+                for (size_t w = 0; w < block_words; ++w)
+                    group_hits &= block[w] | ignored[w];
+                hits[group] = group_hits;
+            }
+        }
+    };
+
+    //!\brief Returns an agent for queries.
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+
+    //!\brief Serialises the blocked ibf with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(bins, hash_functions, groups, blocks, data);
+    }
+
+private:
+    //!\brief The number of bins.
+    size_t bins{};
+    //!\brief The number of hash functions.
+    size_t hash_functions{};
+    //!\brief The number of groups of 64 bins.
+    size_t groups{};
+    //!\brief The number of blocks per bin.
+    size_t blocks{};
+    //!\brief The blocks, the blocks of all groups for the same value follow each other.
+    std::vector<uint64_t> data{};
+
+    //!\brief The first word of the block of a hashed value in a group. The higher bits of the hash select the block.
+    size_t block_of(uint64_t const hash, size_t const group) const noexcept
+    {
+        uint64_t const block = (static_cast<__uint128_t>(hash) * static_cast<__uint128_t>(blocks)) >> 64;
+        return (block * groups + group) * block_words;
+    }
+
+    /*! \brief The words of the block, that a hashed value sets, bit w is set for word w.
+     *  Every hash function picks one of the words, that are not picked yet, with 12 bits of a second hash, so that
+     *  the words are independent of the block.
+     */
+    uint64_t words_of(uint64_t const hash) const noexcept
+    {
+        uint64_t const bits = murmur_mix(hash + 0x9E3779B97F4A7C15ULL);
+        uint64_t words{};
+        for (size_t i = 0; i < hash_functions; ++i)
+        {
+            uint64_t left = ~words & 0xFF;
+            for (uint64_t skip = (((bits >> (12 * i)) & 0xFFF) * (block_words - i)) >> 12; skip > 0; --skip)
+                left &= left - 1;
+            words |= left & -left;
+        }
+        return words;
+    }
+};
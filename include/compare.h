@@ -14,6 +14,8 @@
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
 
+#include "mapped_ibf.hpp"
+
 inline constexpr static uint64_t adjust_seed(uint8_t const kmer_size, uint64_t const seed = 0x8F3F73B5CF1C9ADEULL) noexcept
 {
     return seed >> (64u - 2u * kmer_size);
@@ -53,16 +55,30 @@ struct range_arguments : minimiser_arguments, strobemer_arguments, syncmer_argum
 
    methods name;
    uint8_t k_size;
+   size_t threads{1};
+};
+
+struct coverage_arguments : range_arguments
+{
+   bool islands{false};
 };
 
 struct accuracy_arguments : range_arguments
 {
    std::vector<std::filesystem::path> input_file{};
    uint64_t ibfsize{};
+   double fpr{0.05};
    size_t number_hashes{1};
    std::filesystem::path search_file{};
    std::filesystem::path solution_file{};
-   float threshold{0.5};
+   std::vector<float> thresholds{0.5};
+   bool no_store{false};
+   bool compressed{false};
+   bool hierarchical{false};
+   bool blocked{false};
+   bool dedup{false};
+   bool exact{false};
+   bool xor_filters{false};
 };
 
 //!\brief Use dna4 instead of default dna5
@@ -71,15 +87,6 @@ struct my_traits : seqan3::sequence_file_input_default_traits_dna
     using sequence_alphabet = seqan3::dna4;
 };
 
-//!\brief Use char and strings for strobemers
-struct my_traits2 : seqan3::sequence_file_input_default_traits_dna
-{
-    using 	sequence_legal_alphabet = char;
-    using sequence_alphabet = char;
-    template <typename alph>
-    using sequence_container = std::string;
-};
-
 /*! \brief Function, loading compressed and uncompressed ibfs
  *  \param ibf   ibf to load
  *  \param ipath Path, where the ibf can be found.
@@ -87,6 +94,16 @@ struct my_traits2 : seqan3::sequence_file_input_default_traits_dna
 template <class IBFType>
 void load_ibf(IBFType & ibf, std::filesystem::path ipath)
 {
+    // Files written by store_mapped_ibf are copied into the ibf.
+    if constexpr (std::constructible_from<IBFType, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>>)
+    {
+        if (is_mapped_ibf(ipath))
+        {
+            ibf = IBFType{mapped_ibf{ipath}.to_ibf()};
+            return;
+        }
+    }
+
     std::ifstream is{ipath, std::ios::binary};
     cereal::BinaryInputArchive iarchive{is};
     iarchive(ibf);
@@ -102,7 +119,7 @@ void store_ibf(IBFType const & ibf,
 {
     std::ofstream os{opath, std::ios::binary};
     cereal::BinaryOutputArchive oarchive{os};
-    oarchive(seqan3::interleaved_bloom_filter(ibf));
+    oarchive(ibf);
 }
 
 /*! \brief Function, comparing the methods in regard of their coverage.
@@ -117,10 +134,10 @@ void do_accuracy(accuracy_arguments & args);
 void do_counts(std::vector<std::filesystem::path> sequence_files, range_arguments & args);
 
 /*! \brief Function, comparing the methods in regard of their coverage.
- *  \param sequence_file A sequence file.
+ *  \param sequence_files A vector of sequence files.
  *  \param args The arguments about the view to be used.
  */
-void do_coverage(std::filesystem::path sequence_file, range_arguments & args);
+void do_coverage(std::vector<std::filesystem::path> sequence_files, coverage_arguments & args);
 
 /*! \brief Function, comparing the speed.
  *  \param sequence_files A vector of sequence files.
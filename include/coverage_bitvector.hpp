@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include <seqan3/search/kmer_index/shape.hpp>
+
+/*! \brief Marks, which positions of a sequence are covered by at least one submer, with one bit per position.
+ *  A submer sets the bits of its shape at once, covered positions are counted with popcount and islands, i.e. runs of
+ *  uncovered positions, are found by counting trailing ones and zeros of whole words.
+ */
+class coverage_bitvector
+{
+public:
+    /*! \brief Construct a bitvector, in which no position is covered.
+     *  \param size  The number of positions, e.g. the length of the sequence.
+     *  \param shape The shape of the submers. Must not be longer than 64.
+     */
+    coverage_bitvector(size_t const size, seqan3::shape const & shape) :
+        size{size},
+        words((size + 63) / 64, 0)
+    {
+        for (size_t pos = 0; pos < shape.size(); ++pos)
+        {
+            if (shape[pos] == 1)
+                mask |= uint64_t{1} << pos;
+        }
+    }
+
+    /*! \brief Covers the positions of the shape, starting at the given position.
+     *  \param position The starting position of the submer. The submer must lie within the sequence.
+     */
+    void cover(uint64_t const position) noexcept
+    {
+        size_t const word = position / 64;
+        size_t const offset = position % 64;
+        words[word] |= mask << offset;
+        if (offset > 0 && word + 1 < words.size())
+            words[word + 1] |= mask >> (64 - offset);
+    }
+
+    //!\brief The number of covered positions.
+    uint64_t count() const noexcept
+    {
+        uint64_t covered{};
+        for (uint64_t const word : words)
+            covered += std::popcount(word);
+        return covered;
+    }
+
+    /*! \brief Calls the given function for every island in increasing order.
+     *  \param on_island Called with the starting position and the length of an island.
+     */
+    template <typename fn_t>
+    void for_each_island(fn_t && on_island) const
+    {
+        uint64_t island{};
+        for (size_t word = 0; word < words.size(); ++word)
+        {
+            size_t const valid = std::min<size_t>(64, size - word * 64);
+            uint64_t const gaps = ~words[word];
+            size_t bit{};
+            while (bit < valid)
+            {
+                uint64_t const rest = gaps >> bit;
+                if (rest & 1)
+                {
+                    size_t const length = std::min<size_t>(std::countr_one(rest), valid - bit);
+                    island += length;
+                    bit += length;
+                }
+                else
+                {
+                    if (island > 0)
+                        on_island(word * 64 + bit - island, island);
+                    island = 0;
+                    bit += std::min<size_t>(std::countr_zero(rest), valid - bit);
+                }
+            }
+        }
+        if (island > 0)
+            on_island(size - island, island);
+    }
+
+private:
+    //!\brief The number of positions.
+    size_t size{};
+    //!\brief The bits, position i is stored in bit i % 64 of word i / 64.
+    std::vector<uint64_t> words{};
+    //!\brief The covered positions of a submer starting at 0.
+    uint64_t mask{};
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+#include "bin_bitvector.hpp"
+#include "minimal_perfect_hash.hpp"
+
+/*! \brief An exact index of the bins of values, an alternative to an ibf without false positives.
+ *  A minimal perfect hash function maps every distinct value of all bins to a number. The value itself is stored at its
+ *  number to reject other values, followed by the list of its bins. As the bins overlap little, most lists have one
+ *  entry, so the index needs about 20 bytes per distinct value independent of the number of bins.
+ */
+class exact_index
+{
+public:
+    exact_index() = default;
+
+    /*! \brief Construct the index.
+     *  \param bin_values The values of every bin, which may contain duplicates.
+     */
+    explicit exact_index(std::vector<std::vector<uint64_t>> const & bin_values) :
+        bins{bin_values.size()}
+    {
+        std::vector<std::pair<uint64_t, uint32_t>> entries{};
+        for (size_t bin = 0; bin < bin_values.size(); ++bin)
+            for (uint64_t const value : bin_values[bin])
+                entries.emplace_back(value, bin);
+        std::sort(entries.begin(), entries.end());
+        entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+        std::vector<uint64_t> distinct{};
+        for (auto const & [value, bin] : entries)
+            if (distinct.empty() || distinct.back() != value)
+                distinct.push_back(value);
+        hash = minimal_perfect_hash{distinct};
+
+        // The number of bins of every value, at its number, are turned into the start of its list.
+        values.assign(distinct.size(), 0);
+        starts.assign(distinct.size() + 1, 0);
+        for (auto const & [value, bin] : entries)
+            ++starts[hash(value) + 1];
+        for (size_t number = 0; number < distinct.size(); ++number)
+            starts[number + 1] += starts[number];
+
+        lists.resize(entries.size());
+        std::vector<uint64_t> next(starts.begin(), starts.end() - 1);
+        for (auto const & [value, bin] : entries)
+        {
+            uint64_t const number = hash(value);
+            values[number] = value;
+            lists[next[number]++] = bin;
+        }
+    }
+
+    //!\brief The number of bins.
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    //!\brief The number of distinct values.
+    size_t size() const noexcept
+    {
+        return values.size();
+    }
+
+    //!\brief The memory of the index in bytes.
+    uint64_t bytes() const noexcept
+    {
+        return hash.bytes() + 8 * (values.size() + starts.size()) + 4 * lists.size();
+    }
+
+    //!\brief Looks up the bin lists of values and keeps the last one, so each thread uses an agent of its own.
+    class membership_agent_type
+    {
+    public:
+        //!\brief Construct an agent for the given index.
+        explicit membership_agent_type(exact_index const & index) :
+            index{&index},
+            result{index.bins}
+        {}
+
+        /*! \brief Determines, which bins contain the value.
+         *  \param value The value.
+         *  \returns A reference to the result, which is overwritten by the next query.
+         */
+        bin_bitvector const & bulk_contains(uint64_t const value) noexcept
+        {
+            // Only the bits of the last result are cleared.
+            for (uint32_t const bin : set)
+                result.raw_data()[bin / 64] = 0;
+            set = {};
+
+            if (index->values.empty())
+                return result;
+            uint64_t const number = index->hash(value);
+            if (index->values[number] != value)
+                return result;
+
+            set = {index->lists.data() + index->starts[number], index->lists.data() + index->starts[number + 1]};
+            for (uint32_t const bin : set)
+                result.raw_data()[bin / 64] |= uint64_t{1} << (bin % 64);
+            return result;
+        }
+
+    private:
+        //!\brief The index.
+        exact_index const * index{};
+        //!\brief The result of the last query.
+        bin_bitvector result{};
+        //!\brief The bins of the last result.
+        std::span<uint32_t const> set{};
+    };
+
+    //!\brief Returns an agent for queries.
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+
+    //!\brief Serialises the index with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(bins, hash, values, starts, lists);
+    }
+
+private:
+    //!\brief The number of bins.
+    size_t bins{};
+    //!\brief The numbers of the distinct values.
+    minimal_perfect_hash hash{};
+    //!\brief The value at every number.
+    std::vector<uint64_t> values{};
+    //!\brief The start of the list of bins of every number, and the end of the last list.
+    std::vector<uint64_t> starts{};
+    //!\brief The lists of bins, sorted.
+    std::vector<uint32_t> lists{};
+};
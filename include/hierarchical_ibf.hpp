@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+#include "bit_sliced_counter.hpp"
+#include "ibf_sizing.hpp"
+#include "shared.hpp"
+
+/*! \brief A two-level hierarchical ibf for bins of very different sizes.
+ *  The bins of the ibf on the top level are technical bins: A large user bin is split into several technical bins, its
+ *  values are distributed among them by their hash. Small user bins are merged into one technical bin, that contains
+ *  the union of their values, and get an ibf of their own on the lower level. So every technical bin holds about the
+ *  same number of values and the ibfs are much smaller than an ibf, in which every bin has the size of the largest.
+ *  The count of a split bin is the sum of the counts of its parts. The count of a merged bin bounds the counts of its
+ *  user bins, so the lower ibf is only searched, if the merged bin reaches the threshold.
+ */
+class hierarchical_ibf
+{
+public:
+    //!\brief The ibf type used on both levels.
+    using ibf_t = seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>;
+
+    hierarchical_ibf() = default;
+
+    /*! \brief Computes the layout for the given user bins and creates empty ibfs.
+     *  \param elements           The number of distinct values per user bin.
+     *  \param fpr                The false positive rate of a user bin.
+     *  \param max_technical_bins The number of technical bins on the top level, that the values are spread over.
+     *                            Default: 64.
+     */
+    hierarchical_ibf(std::vector<uint64_t> const & elements, double const fpr, size_t const max_technical_bins = 64) :
+        top_bin(elements.size()),
+        parts(elements.size(), 1),
+        lower(elements.size(), no_lower),
+        lower_bin(elements.size(), 0)
+    {
+        uint64_t const total = std::accumulate(elements.begin(), elements.end(), uint64_t{});
+        uint64_t const capacity = std::max<uint64_t>(1, (total + max_technical_bins - 1) / max_technical_bins);
+
+        std::vector<size_t> order(elements.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&] (size_t a, size_t b) { return elements[a] > elements[b]; });
+
+        // Technical bins of the top level with their number of values and their false positive rate.
+        std::vector<std::pair<uint64_t, double>> top_bins{};
+        std::vector<std::vector<size_t>> merged{};
+        size_t i = 0;
+
+        // Large user bins are split, the false positive rate of a part is lowered, so that the sum of the parts keeps
+        // the false positive rate of the user bin.
+        for (; i < order.size() && elements[order[i]] > capacity; ++i)
+        {
+            size_t const user_bin = order[i];
+            parts[user_bin] = (elements[user_bin] + capacity - 1) / capacity;
+            top_bin[user_bin] = top_bins.size();
+            double const part_fpr = 1 - std::pow(1 - fpr, 1.0 / parts[user_bin]);
+            for (size_t part = 0; part < parts[user_bin]; ++part)
+                top_bins.emplace_back((elements[user_bin] + parts[user_bin] - 1) / parts[user_bin], part_fpr);
+        }
+
+        // Small user bins are merged in decreasing order, as long as they fit into one technical bin.
+        while (i < order.size())
+        {
+            std::vector<size_t> members{order[i]};
+            uint64_t content = elements[order[i]];
+            for (++i; i < order.size() && content + elements[order[i]] <= capacity; ++i)
+            {
+                members.push_back(order[i]);
+                content += elements[order[i]];
+            }
+
+            for (size_t const user_bin : members)
+                top_bin[user_bin] = top_bins.size();
+            top_bins.emplace_back(content, fpr);
+            if (members.size() > 1)
+                merged.push_back(std::move(members));
+        }
+
+        ibf_size const top_size = optimal_ibf_size(top_bins);
+        top = ibf_t{seqan3::bin_count{std::max<size_t>(1, top_bins.size())},
+                    seqan3::bin_size{top_size.bin_size},
+                    seqan3::hash_function_count{top_size.hash_count}};
+
+        for (auto const & members : merged)
+        {
+            uint64_t largest{};
+            for (size_t m = 0; m < members.size(); ++m)
+            {
+                lower[members[m]] = lowers.size();
+                lower_bin[members[m]] = m;
+                largest = std::max(largest, elements[members[m]]);
+            }
+            ibf_size const lower_size = optimal_ibf_size(largest, fpr);
+            lowers.emplace_back(seqan3::bin_count{members.size()},
+                                seqan3::bin_size{lower_size.bin_size},
+                                seqan3::hash_function_count{lower_size.hash_count});
+        }
+        lower_members = std::move(merged);
+    }
+
+    /*! \brief Inserts a value into a user bin.
+     *  \param value    The value.
+     *  \param user_bin The user bin.
+     */
+    void emplace(uint64_t const value, size_t const user_bin)
+    {
+        size_t const part = parts[user_bin] == 1 ? 0 : murmur_mix(value) % parts[user_bin];
+        top.emplace(value, seqan3::bin_index{top_bin[user_bin] + part});
+        if (lower[user_bin] != no_lower)
+            lowers[lower[user_bin]].emplace(value, seqan3::bin_index{lower_bin[user_bin]});
+    }
+
+    //!\brief The number of user bins.
+    size_t bin_count() const noexcept
+    {
+        return top_bin.size();
+    }
+
+    //!\brief The number of technical bins of the top level.
+    size_t technical_bin_count() const noexcept
+    {
+        return top.bin_count();
+    }
+
+    //!\brief The number of ibfs on the lower level.
+    size_t lower_count() const noexcept
+    {
+        return lowers.size();
+    }
+
+    //!\brief The number of technical bins, a user bin is split into.
+    size_t split_count(size_t const user_bin) const noexcept
+    {
+        return parts[user_bin];
+    }
+
+    //!\brief The memory of the bit data of all ibfs in bytes.
+    uint64_t bytes() const noexcept
+    {
+        uint64_t result = ibf_size{top.bin_size(), top.hash_function_count()}.bytes(top.bin_count());
+        for (auto const & ibf : lowers)
+            result += ibf_size{ibf.bin_size(), ibf.hash_function_count()}.bytes(ibf.bin_count());
+        return result;
+    }
+
+    //!\brief Counts the hits of the user bins, every thread needs its own agent.
+    class membership_agent_type
+    {
+    public:
+        //!\brief Construct an agent for the given hierarchical ibf.
+        explicit membership_agent_type(hierarchical_ibf const & hibf) :
+            hibf{&hibf},
+            top_agent{hibf.top.membership_agent()},
+            top_counter{hibf.top.bin_count()},
+            counts(hibf.bin_count(), 0)
+        {
+            for (auto const & ibf : hibf.lowers)
+            {
+                lower_agents.push_back(ibf.membership_agent());
+                lower_counters.emplace_back(ibf.bin_count());
+            }
+        }
+
+        /*! \brief Counts, how many of the values are contained in each user bin.
+         *  \param values    The values, e.g. the hashes of a read.
+         *  \param threshold Counts below the threshold are only upper bounds, a lower ibf is only searched, if its
+         *                   merged bin reaches the threshold.
+         *  \returns The count per user bin, which is overwritten by the next call.
+         */
+        std::vector<uint64_t> const & bulk_count(std::vector<uint64_t> const & values, uint64_t const threshold)
+        {
+            top_counter.clear();
+            for (uint64_t const value : values)
+                top_counter.add(top_agent.bulk_contains(value).raw_data().data());
+
+            for (size_t user_bin = 0; user_bin < counts.size(); ++user_bin)
+            {
+                counts[user_bin] = 0;
+                for (size_t part = 0; part < hibf->parts[user_bin]; ++part)
+                    counts[user_bin] += top_counter.count(hibf->top_bin[user_bin] + part);
+            }
+
+            for (size_t l = 0; l < lower_agents.size(); ++l)
+            {
+                // All user bins of a lower ibf share the merged bin, any of them gives its count.
+                auto const & members = hibf->lower_members[l];
+                if (counts[members.front()] < threshold)
+                    continue;
+
+                bit_sliced_counter & lower_counter = lower_counters[l];
+                lower_counter.clear();
+                for (uint64_t const value : values)
+                    lower_counter.add(lower_agents[l].bulk_contains(value).raw_data().data());
+                for (size_t const user_bin : members)
+                    counts[user_bin] = lower_counter.count(hibf->lower_bin[user_bin]);
+            }
+            return counts;
+        }
+
+    private:
+        //!\brief The hierarchical ibf.
+        hierarchical_ibf const * hibf{};
+        //!\brief The agent of the top level.
+        decltype(std::declval<ibf_t const &>().membership_agent()) top_agent;
+        //!\brief The agents of the lower level.
+        std::vector<decltype(std::declval<ibf_t const &>().membership_agent())> lower_agents{};
+        //!\brief The counts of the technical bins of the top level.
+        bit_sliced_counter top_counter{};
+        //!\brief The counts of the bins of the lower ibfs.
+        std::vector<bit_sliced_counter> lower_counters{};
+        //!\brief The counts of the user bins.
+        std::vector<uint64_t> counts{};
+    };
+
+    //!\brief Returns an agent for queries.
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+
+    //!\brief Serialises the hierarchical ibf with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(top, lowers, top_bin, parts, lower, lower_bin);
+
+        lower_members.assign(lowers.size(), {});
+        for (size_t user_bin = 0; user_bin < lower.size(); ++user_bin)
+        {
+            if (lower[user_bin] == no_lower)
+                continue;
+            auto & members = lower_members[lower[user_bin]];
+            members.resize(std::max(members.size(), lower_bin[user_bin] + 1));
+            members[lower_bin[user_bin]] = user_bin;
+        }
+    }
+
+private:
+    //!\brief Marks a user bin without a lower ibf.
+    static constexpr size_t no_lower{static_cast<size_t>(-1)};
+
+    //!\brief The ibf of the top level.
+    ibf_t top{};
+    //!\brief The ibfs of the lower level, one per merged bin.
+    std::vector<ibf_t> lowers{};
+    //!\brief The first technical bin of the top level per user bin.
+    std::vector<size_t> top_bin{};
+    //!\brief The number of technical bins of the top level per user bin, more than one for split bins.
+    std::vector<size_t> parts{};
+    //!\brief The lower ibf per user bin, or no_lower.
+    std::vector<size_t> lower{};
+    //!\brief The bin in the lower ibf per user bin.
+    std::vector<size_t> lower_bin{};
+    //!\brief The user bins per lower ibf, ordered by their bin in it.
+    std::vector<std::vector<size_t>> lower_members{};
+};
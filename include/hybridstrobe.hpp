@@ -0,0 +1,560 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides hybridstrobe.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/range/detail/adaptor_from_functor.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/utility/range/concept.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
+
+#include "sliding_window_minimum.hpp"
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// hybridstrobe_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by hybridstrobe.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::forward_range, the reference type must
+ *                 model std::unsigned_integral. The typical use case is that the reference type is the result of
+ *                 seqan3::kmer_hash.
+ * \tparam measure_distance If true, then not the actual hybridstrobes are returned, but the distances between the
+ *                          positions of their second strobes.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ *
+ * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t, bool measure_distance = false>
+class hybridstrobe_view : public std::ranges::view_interface<hybridstrobe_view<urng_t, measure_distance>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The hybridstrobe_view only works on forward_ranges.");
+    static_assert(std::unsigned_integral<std::ranges::range_value_t<urng_t>>,
+                  "The value type of the underlying range must model std::unsigned_integral.");
+
+    //!\brief Whether the given ranges are const_iterable.
+    static constexpr bool const_iterable = seqan3::const_iterable_range<urng_t>;
+
+    //!\brief The underlying range.
+    urng_t urange{};
+
+    //!\brief lower offset for the position of the next window.
+    size_t window_min{};
+
+    //!\brief upper offset for the position of the next window.
+    size_t window_max{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+    //!\brief The sentinel type of the hybridstrobe_view.
+    using sentinel = std::default_sentinel_t;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+     /// \cond Workaround_Doxygen
+    hybridstrobe_view() requires std::default_initializable<urng_t> = default; //!< Defaulted.
+    /// \endcond
+    hybridstrobe_view(hybridstrobe_view const & rhs) = default; //!< Defaulted.
+    hybridstrobe_view(hybridstrobe_view && rhs) = default; //!< Defaulted.
+    hybridstrobe_view & operator=(hybridstrobe_view const & rhs) = default; //!< Defaulted.
+    hybridstrobe_view & operator=(hybridstrobe_view && rhs) = default; //!< Defaulted.
+    ~hybridstrobe_view() = default; //!< Defaulted.
+
+    /*!\brief Construct from a view and the two (lower and upper) offsets of the next window.
+    * \param[in] urange     The input range to process. Must model std::ranges::viewable_range and
+    *                        std::ranges::forward_range.
+    * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+    */
+    hybridstrobe_view(urng_t urange, size_t const window_min, size_t const window_max) :
+        urange{std::move(urange)},
+        window_min{window_min},
+        window_max{window_max}
+    {}
+
+    /*!\brief Construct from a non-view that can be view-wrapped and the two (lower and upper) offsets
+    *        of the next window.
+    * \tparam other_urng_t   The type of another urange. Must model std::ranges::viewable_range and be
+                             constructible from urng_t.
+    * \param[in] urange     The input range to process. Must model std::ranges::viewable_range and
+    *                        std::ranges::forward_range.
+    * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+    */
+    template <typename other_urng_t>
+    //!\cond
+        requires (std::ranges::viewable_range<other_urng_t> &&
+                  std::constructible_from<urng_t, ranges::ref_view<std::remove_reference_t<other_urng_t>>>)
+    //!\endcond
+    hybridstrobe_view(other_urng_t && urange, size_t const window_min, size_t const window_max) :
+        urange{std::views::all(std::forward<other_urng_t>(urange))},
+        window_min{window_min},
+        window_max{window_max}
+    {}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of values spanned by one hybridstrobe.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(urange),
+                std::ranges::end(urange),
+                window_min,
+                window_max};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+    //!\cond
+        requires const_iterable
+    //!\endcond
+    {
+        return {std::ranges::cbegin(urange),
+                std::ranges::cend(urange),
+                window_min,
+                window_max};
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the range.
+     * \returns Iterator to the end.
+     *
+     * \details
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    sentinel end() const
+    {
+        return {};
+    }
+    //!\}
+};
+
+//!\brief Iterator for calculating hybridstrobes.
+template <std::ranges::view urng_t, bool measure_distance>
+template <bool const_range>
+class hybridstrobe_view<urng_t, measure_distance>::basic_iterator
+{
+private:
+    //!\brief The sentinel type of the underlying range.
+    using urng_sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_t = maybe_const_iterator_t<const_range, urng_t>;
+
+    template <bool>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ranges::range_difference_t<urng_t>;
+    //!\brief Value type of the iterator.
+    using value_t = std::ranges::range_value_t<urng_t>;
+    //!\brief Value type of the output.
+    using value_type = std::conditional_t<measure_distance, size_t, std::array<value_t, 2>>;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default; //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default; //!< Defaulted.
+    ~basic_iterator() = default; //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+    //!\cond
+        requires const_range
+    //!\endcond
+        : hybridstrobe_value{std::move(it.hybridstrobe_value)},
+          urng_iterator{std::move(it.urng_iterator)},
+          urng_sentinel{std::move(it.urng_sentinel)},
+          ring_buffer{std::move(it.ring_buffer)},
+          ring_mask{std::move(it.ring_mask)},
+          ring_head{std::move(it.ring_head)},
+          window_min{std::move(it.window_min)},
+          segment_size{std::move(it.segment_size)},
+          segments{std::move(it.segments)},
+          second_position{std::move(it.second_position)},
+          last_second_position{std::move(it.last_second_position)}
+    {}
+
+    /*!\brief Construct from begin and end iterators of a given range over std::unsigned_integral values, and the two
+    *         (lower and upper) offsets of the next window.
+    * \param[in] urng_iterator   Iterator pointing to the first position of the std::unsigned_integral range.
+    * \param[in] urng_sentinel   Iterator pointing to the last position of the std::unsigned_integral range.
+    * \param[in] window_min      The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max      The upper offset for the position of the next window from the previous one.
+    *
+    * \details
+    *
+    * Fills a ring buffer with all values spanned by the first hybridstrobe and the three segment minima. Afterwards,
+    * the underlying iterator always points to the last value of the last segment, so every increment reads exactly
+    * one new value. If the range is too short to contain a single hybridstrobe, the iterator is equal to the sentinel.
+    */
+    basic_iterator(urng_iterator_t urng_iterator,
+                   urng_sentinel_t urng_sentinel,
+                   size_t window_min,
+                   size_t window_max) :
+        urng_iterator{std::move(urng_iterator)},
+        urng_sentinel{std::move(urng_sentinel)},
+        window_min{window_min},
+        segment_size{(window_max - window_min + 1) / segment_count}
+    {
+        window_first();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_hybridstrobe
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return (lhs.urng_iterator == rhs.urng_iterator);
+    }
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the hybridstrobe_view.
+    friend bool operator==(basic_iterator const & lhs, sentinel const &)
+    {
+        return lhs.urng_iterator == lhs.urng_sentinel;
+    }
+
+    //!\brief Compare to the sentinel of the hybridstrobe_view.
+    friend bool operator==(sentinel const & lhs, basic_iterator const & rhs)
+    {
+        return rhs == lhs;
+    }
+
+    //!\brief Compare to the sentinel of the hybridstrobe_view.
+    friend bool operator!=(sentinel const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the hybridstrobe_view.
+    friend bool operator!=(basic_iterator const & lhs, sentinel const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        next_unique_hybridstrobe();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+    {
+        basic_iterator tmp{*this};
+        next_unique_hybridstrobe();
+        return tmp;
+    }
+
+    //!\brief Return the hybridstrobe.
+    value_type operator*() const noexcept
+    {
+        return hybridstrobe_value;
+    }
+
+private:
+    //!\brief The number of segments the window of the second strobe is split into.
+    static constexpr size_t segment_count{3};
+
+    //!\brief The hybridstrobe value.
+    value_type hybridstrobe_value{};
+
+    //!\brief Iterator to the right most value of the last segment.
+    urng_iterator_t urng_iterator{};
+
+    //!\brief Iterator to last element in range.
+    urng_sentinel_t urng_sentinel{};
+
+    //!\brief Stores the values spanned by one hybridstrobe. Its size is a power of two, so indices wrap with a mask.
+    std::vector<value_t> ring_buffer{};
+
+    //!\brief The mask used to wrap indices of the ring buffer.
+    size_t ring_mask{};
+
+    //!\brief The index of the first strobe in the ring buffer.
+    size_t ring_head{};
+
+    //!\brief lower offset for the position of the next window.
+    size_t window_min{};
+
+    //!\brief The number of values in one segment.
+    size_t segment_size{};
+
+    //!\brief The sliding minima of the segments, shared by all consecutive hybridstrobes.
+    std::array<sliding_window_minimum<value_t>, segment_count> segments{};
+
+    //!\brief The position of the second strobe in the underlying range.
+    size_t second_position{};
+
+    //!\brief The position of the last second strobe, whose distance was reported. Only relevant, if measure_distance
+    //!       is true.
+    size_t last_second_position{};
+
+    //!\brief Returns the value at the given offset from the first strobe.
+    value_t value_at(size_t const offset) const noexcept
+    {
+        return ring_buffer[(ring_head + offset) & ring_mask];
+    }
+
+    //!\brief Returns the offset of the first value in the given segment from the first strobe.
+    size_t segment_begin(size_t const segment) const noexcept
+    {
+        return window_min + segment * segment_size;
+    }
+
+    //!\brief Fills the ring buffer and the segment minima with the values of the first hybridstrobe.
+    void window_first()
+    {
+        size_t const span = segment_begin(segment_count);
+        ring_buffer.resize(std::bit_ceil(span));
+        ring_mask = ring_buffer.size() - 1;
+
+        for (size_t i = 0; i < span; ++i)
+        {
+            if (urng_iterator == urng_sentinel)
+                return;
+
+            ring_buffer[i] = *urng_iterator;
+
+            if (i + 1 < span)
+                ++urng_iterator;
+        }
+
+        for (size_t segment = 0; segment < segment_count; ++segment)
+        {
+            segments[segment] = sliding_window_minimum<value_t>{segment_size};
+            for (size_t offset = segment_begin(segment); offset < segment_begin(segment + 1); ++offset)
+                segments[segment].push(value_at(offset));
+        }
+
+        // The reported distance of the first second strobe is measured from the first possible position.
+        last_second_position = window_min - 1;
+        if (!select_strobes())
+            next_unique_hybridstrobe();
+    }
+
+    /*!\brief Selects the strobes of the current hybridstrobe.
+     * \returns True, if a new value is stored. Otherwise returns false, which can only happen, if measure_distance
+     *          is true.
+     * \details
+     * The first strobe is the value at the current position. The segment for the second strobe is given by the first
+     * strobe modulo the number of segments and the second strobe is the minimum in that segment.
+     */
+    bool select_strobes()
+    {
+        value_t const first = value_at(0);
+        size_t const segment = first % segment_count;
+        second_position = segment_begin(segment) + segments[segment].min_position();
+
+        if constexpr (measure_distance)
+        {
+            if (second_position <= last_second_position)
+                return false;
+
+            hybridstrobe_value = second_position - last_second_position - 1;
+            last_second_position = second_position;
+        }
+        else
+        {
+            hybridstrobe_value = {first, segments[segment].min_value()};
+        }
+        return true;
+    }
+
+    /*!\brief Calculates the next hybridstrobe value.
+     * \returns True, if a new value is stored or the end is reached. Otherwise returns false.
+     * \details
+     * Every segment moves by one position, so each segment minimum receives the value that follows its last value.
+     */
+    bool next_hybridstrobe()
+    {
+        ++urng_iterator;
+
+        if (urng_iterator == urng_sentinel)
+            return true;
+
+        ring_head = (ring_head + 1) & ring_mask;
+        ring_buffer[(ring_head + segment_begin(segment_count) - 1) & ring_mask] = *urng_iterator;
+
+        for (size_t segment = 0; segment < segment_count; ++segment)
+            segments[segment].push(value_at(segment_begin(segment + 1) - 1));
+
+        return select_strobes();
+    }
+
+    //!\brief Increments the iterator until a new value is stored or the end is reached.
+    void next_unique_hybridstrobe()
+    {
+        while (!next_hybridstrobe()) {}
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+hybridstrobe_view(rng_t &&, size_t const window_min, size_t const window_max) -> hybridstrobe_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// hybridstrobe_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//![adaptor_def]
+//!\brief hybridstrobe's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct hybridstrobe_fn
+{
+    //!\brief Store the two window offsets and return a range adaptor closure object.
+    constexpr auto operator()(const size_t window_min, const size_t window_max) const
+    {
+        return adaptor_from_functor{*this, window_min, window_max};
+    }
+
+    /*!\brief Call the view's constructor with three arguments: the underlying view and an integer indicating a lower
+     *        offset and another integer indicating the upper offset of the next window.
+     * \tparam urng_t         The type of the input range to process. Must model std::ranges::viewable_range.
+     * \param[in] urange      The input range to process. Must model std::ranges::viewable_range and
+     *                        std::ranges::forward_range.
+     * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+     * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+     * \throws std::invalid_argument if window_min is smaller than 2 or window_max is smaller than window_min + 2.
+     * \returns  A range of the converted values in arrays of size 2.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, size_t const window_min, size_t const window_max) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::hybridstrobe cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+                      "The range parameter to views::hybridstrobe must model std::ranges::forward_range.");
+
+        if (window_min < 2 || window_max < window_min + 2)
+            throw std::invalid_argument{"The chosen min and max windows are not valid. "
+                                        "Please choose a window_min greater than 1 and a window_max at least two "
+                                        "greater than window_min."};
+
+        return hybridstrobe_view<std::views::all_t<urng_t>>{std::forward<urng_t>(urange), window_min, window_max};
+    }
+};
+//![adaptor_def]
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief Computes hybridstrobes for a range of comparable values. A hybridstrobe consists of a starting strobe
+ * and a second strobe, that is the minimum of one of three segments of the following window.
+ * \tparam urng_t The type of the range being processed. See below for requirements. [template
+ *                 parameter is omitted in pipe notation]
+ * \param[in] urange The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+ * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+ * \throws std::invalid_argument if window_min is smaller than 2 or window_max is smaller than window_min + 2.
+ * \returns A range of std::unsigned_integral where each value is an array of size 2. See below for the
+ *          properties of the returned range.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * A hybridstrobe defined by [Sahlin K.](https://genome.cshlp.org/content/31/11/2080.full.pdf) splits the window
+ * with the offsets `[window_min, window_max]` relative to the first strobe into three segments of
+ * `(window_max - window_min + 1) / 3` values, remaining values at the end of the window are not used.
+ * The first strobe modulo 3 chooses the segment and the second strobe is the minimum of this segment. If several
+ * values share the minimum, the leftmost one is chosen.
+ * For example for the following list of hash values `[28, 100, 9, 23, 4, 1, 72, 37, 8]` and 2 as `window_min`,
+ * 4 as `window_max`, the hybridstrobe values are `[(28,23),(100,4),(9,4),(23,37),(4,37)]`.
+ *
+ * Each segment keeps its minimum in a monotone queue, which is shared by all consecutive hybridstrobes. Therefore,
+ * every hybridstrobe is computed in amortized constant time and without allocating memory.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | std::unsigned_integral             | std::array                       |
+ *
+ * See the views views submodule documentation for detailed descriptions of the view properties.
+ */
+inline constexpr auto hybridstrobe = detail::hybridstrobe_fn{};
+
+} // namespace seqan3::views
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+#include "mapped_ibf.hpp"
+
+/*! \brief Inserts values into an uncompressed interleaved ibf from several threads at once.
+ *  seqan3::interleaved_bloom_filter::emplace sets the bits with plain writes, so two threads must not insert into bins,
+ *  that share a word, i.e. into the same 64 bins. Here the bits are set with atomic or, so every thread can insert into
+ *  every bin and the insertion scales with the number of threads also for few bins. The positions are the same as the
+ *  ones of emplace.
+ */
+class ibf_inserter
+{
+public:
+    //!\brief Construct an inserter for an ibf, which must outlive the inserter.
+    explicit ibf_inserter(seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed> & ibf) :
+        data{ibf.raw_data().data()},
+        hash_count{ibf.hash_function_count()},
+        hash{ibf.bin_size(), (ibf.bin_count() + 63) / 64 * 64}
+    {}
+
+    /*! \brief Inserts a value into a bin, can be called from several threads at once.
+     *  \param value The value.
+     *  \param bin   The bin.
+     */
+    void emplace(uint64_t const value, seqan3::bin_index const bin) const noexcept
+    {
+        for (size_t i = 0; i < hash_count; ++i)
+        {
+            uint64_t const position = hash(value, i) + bin.get();
+            std::atomic_ref<uint64_t>{data[position / 64]}.fetch_or(uint64_t{1} << (position % 64),
+                                                                    std::memory_order_relaxed);
+        }
+    }
+
+private:
+    //!\brief The bit data of the ibf.
+    uint64_t * data{};
+    //!\brief The number of hash functions.
+    size_t hash_count{};
+    //!\brief The hash functions of the ibf.
+    ibf_hash hash{};
+};
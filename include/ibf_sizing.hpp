@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//!\brief The size of the bins of an ibf and its number of hash functions.
+struct ibf_size
+{
+    //!\brief The number of bits per bin.
+    uint64_t bin_size{};
+    //!\brief The number of hash functions.
+    size_t hash_count{};
+
+    /*! \brief The memory of the bit data of an ibf with this size.
+     *  \param bins The number of bins.
+     *  \returns The memory in bytes, every position has the number of bins rounded up to 64 bits.
+     */
+    uint64_t bytes(size_t const bins) const noexcept
+    {
+        return (bins + 63) / 64 * 8 * bin_size;
+    }
+};
+
+/*! \brief The false positive rate of a bin, i.e. of a Bloom filter.
+ *  \param bin_size   The number of bits of the bin.
+ *  \param hash_count The number of hash functions.
+ *  \param elements   The number of distinct values in the bin.
+ */
+inline double false_positive_rate(uint64_t const bin_size, size_t const hash_count, uint64_t const elements) noexcept
+{
+    if (bin_size == 0)
+        return 1.0;
+    return std::pow(1 - std::exp(-static_cast<double>(hash_count) * elements / bin_size), hash_count);
+}
+
+/*! \brief The smallest bin size and its number of hash functions, so that every bin has at most its false positive rate.
+ *  \param bins           The number of distinct values and the false positive rate in (0, 1) of every bin.
+ *  \param max_hash_count The largest number of hash functions to consider. Default: 5, the maximum of seqan3's ibf.
+ */
+inline ibf_size optimal_ibf_size(std::vector<std::pair<uint64_t, double>> const & bins,
+                                 size_t const max_hash_count = 5)
+{
+    ibf_size best{};
+    for (size_t hash_count = 1; hash_count <= std::max<size_t>(1, max_hash_count); ++hash_count)
+    {
+        uint64_t bin_size{1};
+        for (auto const & [elements, fpr] : bins)
+        {
+            double const rate = std::clamp(fpr, 1e-12, 1 - 1e-12);
+            double const bits = -static_cast<double>(hash_count) * std::max<uint64_t>(elements, 1)
+                              / std::log(1 - std::pow(rate, 1.0 / hash_count));
+            bin_size = std::max<uint64_t>(bin_size, std::ceil(bits));
+        }
+        if (best.hash_count == 0 || bin_size < best.bin_size)
+            best = ibf_size{bin_size, hash_count};
+    }
+    return best;
+}
+
+/*! \brief The smallest bin size and its number of hash functions, so that a bin with the given number of distinct
+ *  values has at most the given false positive rate.
+ *  \param elements       The number of distinct values of the largest bin.
+ *  \param fpr            The false positive rate in (0, 1).
+ *  \param max_hash_count The largest number of hash functions to consider. Default: 5, the maximum of seqan3's ibf.
+ */
+inline ibf_size optimal_ibf_size(uint64_t const elements, double const fpr, size_t const max_hash_count = 5)
+{
+    return optimal_ibf_size(std::vector<std::pair<uint64_t, double>>{{elements, fpr}}, max_hash_count);
+}
+
+/*! \brief An upper bound of the false positive rate of a bin of a blocked_ibf. A value sets hash_count distinct bits
+ *  in one block of 8 bits of the bin, the number of values per block is Poisson distributed. The bits are treated as
+ *  independent, but distinct bits of a value are negatively correlated, so the real rate is a bit lower.
+ *  \param bin_size   The number of bits of the bin.
+ *  \param hash_count The number of hash functions, at most 8.
+ *  \param elements   The number of distinct values in the bin.
+ */
+inline double blocked_false_positive_rate(uint64_t const bin_size, size_t const hash_count, uint64_t const elements)
+    noexcept
+{
+    uint64_t const blocks = bin_size / 8;
+    if (blocks == 0)
+        return 1.0;
+    if (elements == 0)
+        return 0.0;
+    double const load = static_cast<double>(elements) / blocks;
+    double const unset = 1 - std::min<double>(hash_count, 8) / 8;
+    // The probabilities outside of 20 standard deviations around the load are negligible.
+    double const spread = 20 * std::sqrt(load) + 20;
+    uint64_t const first = load > spread ? std::floor(load - spread) : 0;
+    uint64_t const last = std::ceil(load + spread);
+    double const log_load = std::log(std::max(load, 1e-300));
+    double result{};
+    for (uint64_t values = first; values <= last; ++values)
+    {
+        double const probability = std::exp(-load + values * log_load - std::lgamma(values + 1.0));
+        result += probability * std::pow(1 - std::pow(unset, values), hash_count);
+    }
+    return std::min(result, 1.0);
+}
+
+/*! \brief The smallest bin size of a blocked_ibf, a multiple of 8, and its number of hash functions, so that a bin
+ *  with the given number of distinct values has at most the given false positive rate.
+ *  \param elements       The number of distinct values of the largest bin.
+ *  \param fpr            The false positive rate in (0, 1).
+ *  \param max_hash_count The largest number of hash functions to consider. Default: 5.
+ */
+inline ibf_size optimal_blocked_size(uint64_t const elements, double const fpr, size_t const max_hash_count = 5)
+{
+    ibf_size best{};
+    for (size_t hash_count = 1; hash_count <= std::clamp<size_t>(max_hash_count, 1, 8); ++hash_count)
+    {
+        // The false positive rate falls with the number of blocks, which is searched between a too small and a large
+        // enough number.
+        uint64_t enough{std::max<uint64_t>(1, elements / 16)};
+        while (blocked_false_positive_rate(enough * 8, hash_count, elements) > fpr && enough < (uint64_t{1} << 50))
+            enough *= 2;
+        uint64_t too_small{0};
+        while (enough - too_small > 1)
+        {
+            uint64_t const middle = too_small + (enough - too_small) / 2;
+            if (blocked_false_positive_rate(middle * 8, hash_count, elements) > fpr)
+                too_small = middle;
+            else
+                enough = middle;
+        }
+        if (best.hash_count == 0 || enough * 8 < best.bin_size)
+            best = ibf_size{enough * 8, hash_count};
+    }
+    return best;
+}
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <seqan3/std/filesystem>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+#include "bin_bitvector.hpp"
+
+/*! \brief The header of an ibf file, followed by the bit data of the ibf.
+ *  The header has 128 bytes, so the bit data is 64-byte aligned, when the file is mapped to memory.
+ */
+struct mapped_ibf_header
+{
+    //!\brief Identifies an ibf file.
+    std::array<char, 8> magic{'M', 'I', 'N', 'I', 'O', 'N', 'S', '\0'};
+    //!\brief The version of the format.
+    uint32_t version{1};
+    //!\brief The number of hash functions.
+    uint32_t hash_count{};
+    //!\brief The number of bins.
+    uint64_t bin_count{};
+    //!\brief The number of bins rounded up to a multiple of 64, i.e. the number of bits per position.
+    uint64_t technical_bins{};
+    //!\brief The number of bits per bin.
+    uint64_t bin_size{};
+    //!\brief The k-mer size of the method, the ibf was built with.
+    uint64_t k_size{};
+    //!\brief The window size of the method, the ibf was built with.
+    uint64_t w_size{};
+    //!\brief The shape of the method, the ibf was built with.
+    uint64_t shape{};
+    //!\brief The seed of the method, the ibf was built with.
+    uint64_t seed{};
+    //!\brief The name of the method, the ibf was built with, e.g. minimiser_hash_19_19. Zero-terminated.
+    std::array<char, 56> method{};
+
+    //!\brief The current version.
+    static constexpr uint32_t current_version{1};
+};
+
+static_assert(sizeof(mapped_ibf_header) == 128);
+
+/*! \brief The hash functions of seqan3::interleaved_bloom_filter, replicated to find the positions of a value in the
+ *  bit data of an uncompressed ibf without its agent.
+ */
+class ibf_hash
+{
+public:
+    //!\brief The largest number of hash functions.
+    static constexpr size_t max_hash_count{5};
+
+    ibf_hash() = default;
+
+    /*! \brief Construct the hash functions of an ibf.
+     *  \param bin_size       The number of bits per bin.
+     *  \param technical_bins The number of bins rounded up to a multiple of 64.
+     */
+    ibf_hash(uint64_t const bin_size, uint64_t const technical_bins) noexcept :
+        bin_size{bin_size},
+        technical_bins{technical_bins},
+        shift{static_cast<uint64_t>(std::countl_zero(bin_size))}
+    {}
+
+    /*! \brief The first bit of the position of a value for a hash function, a multiple of 64.
+     *  \param h The value.
+     *  \param i The hash function, less than max_hash_count.
+     */
+    uint64_t operator()(uint64_t h, size_t const i) const noexcept
+    {
+        h *= seeds[i];
+        h ^= h >> shift;
+        h *= 11400714819323198485ULL;
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(bin_size)) >> 64);
+        return h * technical_bins;
+    }
+
+private:
+    //!\brief The seeds of the hash functions of seqan3::interleaved_bloom_filter.
+    static constexpr std::array<uint64_t, max_hash_count> seeds{13572355802537770549ULL,
+                                                                13043817825332782213ULL,
+                                                                10650232656628343401ULL,
+                                                                16499269484942379435ULL,
+                                                                4893150838803335377ULL};
+
+    //!\brief The number of bits per bin.
+    uint64_t bin_size{};
+    //!\brief The number of bins rounded up to a multiple of 64.
+    uint64_t technical_bins{};
+    //!\brief Moves the higher bits of a hash into the lower bits, depending on the bin size.
+    uint64_t shift{};
+};
+
+/*! \brief Checks, if a file starts with the header of a mapped ibf.
+ *  \param path The file.
+ */
+inline bool is_mapped_ibf(std::filesystem::path const & path)
+{
+    mapped_ibf_header header{};
+    std::array<char, 8> const magic = header.magic;
+    std::ifstream is{path, std::ios::binary};
+    return is.read(reinterpret_cast<char *>(&header), sizeof(header)) && header.magic == magic;
+}
+
+/*! \brief Stores an ibf with a header, so that it can be used by mapped_ibf. The bit data is written directly.
+ *  \param ibf    The ibf to store.
+ *  \param opath  Path, where the ibf should be stored.
+ *  \param header The parameters of the method, the bins, the bin size and the hash count are set from the ibf.
+ */
+inline void store_mapped_ibf(seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed> const & ibf,
+                             std::filesystem::path const & opath,
+                             mapped_ibf_header header)
+{
+    header.version = mapped_ibf_header::current_version;
+    header.hash_count = ibf.hash_function_count();
+    header.bin_count = ibf.bin_count();
+    header.technical_bins = (ibf.bin_count() + 63) / 64 * 64;
+    header.bin_size = ibf.bin_size();
+
+    std::ofstream os{opath, std::ios::binary};
+    os.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    os.write(reinterpret_cast<char const *>(ibf.raw_data().data()),
+             header.technical_bins * header.bin_size / 8);
+}
+
+/*! \brief A read-only ibf, that is mapped from a file written by store_mapped_ibf.
+ *  Nothing is copied when opening, so several processes searching the same file share the page cache. Queries give
+ *  the same results as seqan3::interleaved_bloom_filter, whose hash functions are replicated here.
+ */
+class mapped_ibf
+{
+public:
+    /*! \brief Maps an ibf file.
+     *  \param path The file.
+     *  \throws std::runtime_error, if the file cannot be mapped or is no ibf file of the current version.
+     */
+    explicit mapped_ibf(std::filesystem::path const & path)
+    {
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error{"Cannot open " + path.string()};
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(mapped_ibf_header))
+        {
+            ::close(fd);
+            throw std::runtime_error{path.string() + " is no ibf file."};
+        }
+        mapped_size = file_stat.st_size;
+        void * const address = ::mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED)
+            throw std::runtime_error{"Cannot map " + path.string()};
+        mapped = static_cast<char const *>(address);
+
+        std::memcpy(&file_header, mapped, sizeof(file_header));
+        if (file_header.magic != mapped_ibf_header{}.magic ||
+            file_header.version != mapped_ibf_header::current_version ||
+            file_header.hash_count == 0 || file_header.hash_count > ibf_hash::max_hash_count ||
+            file_header.technical_bins % 64 != 0 || file_header.technical_bins < file_header.bin_count ||
+            mapped_size < sizeof(mapped_ibf_header) + file_header.technical_bins * file_header.bin_size / 8)
+        {
+            unmap();
+            throw std::runtime_error{path.string() + " is no ibf file of version "
+                                     + std::to_string(mapped_ibf_header::current_version) + "."};
+        }
+        words = reinterpret_cast<uint64_t const *>(mapped + sizeof(mapped_ibf_header));
+        hash = ibf_hash{file_header.bin_size, file_header.technical_bins};
+    }
+
+    mapped_ibf(mapped_ibf const &) = delete;
+    mapped_ibf & operator=(mapped_ibf const &) = delete;
+
+    mapped_ibf(mapped_ibf && other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    mapped_ibf & operator=(mapped_ibf && other) noexcept
+    {
+        unmap();
+        file_header = other.file_header;
+        mapped = std::exchange(other.mapped, nullptr);
+        mapped_size = std::exchange(other.mapped_size, 0);
+        words = std::exchange(other.words, nullptr);
+        hash = other.hash;
+        return *this;
+    }
+
+    ~mapped_ibf()
+    {
+        unmap();
+    }
+
+    //!\brief The header of the file, including the parameters of the method.
+    mapped_ibf_header const & header() const noexcept
+    {
+        return file_header;
+    }
+
+    //!\brief The number of bins.
+    size_t bin_count() const noexcept
+    {
+        return file_header.bin_count;
+    }
+
+    //!\brief The number of bits per bin.
+    size_t bin_size() const noexcept
+    {
+        return file_header.bin_size;
+    }
+
+    //!\brief The number of hash functions.
+    size_t hash_function_count() const noexcept
+    {
+        return file_header.hash_count;
+    }
+
+    //!\brief The bit data in the layout of seqan3::interleaved_bloom_filter.
+    uint64_t const * data() const noexcept
+    {
+        return words;
+    }
+
+    //!\brief Copies the mapped ibf into a seqan3::interleaved_bloom_filter.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed> to_ibf() const
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count()},
+                                             seqan3::bin_size{bin_size()},
+                                             seqan3::hash_function_count{hash_function_count()}};
+        std::memcpy(ibf.raw_data().data(), words, file_header.technical_bins * file_header.bin_size / 8);
+        return ibf;
+    }
+
+    //!\brief Intersects the mapped words of the hash functions, as for the seqan3 ibf one agent per thread.
+    class membership_agent_type
+    {
+    public:
+        //!\brief Construct an agent for the given ibf.
+        explicit membership_agent_type(mapped_ibf const & ibf) :
+            ibf{&ibf},
+            result{ibf.file_header.technical_bins}
+        {}
+
+        /*! \brief Determines, which bins contain the value.
+         *  \param value The value.
+         *  \returns A reference to the result, which is overwritten by the next query.
+         */
+        bin_bitvector const & bulk_contains(uint64_t const value) noexcept
+        {
+            std::array<size_t, ibf_hash::max_hash_count> positions{};
+            for (size_t i = 0; i < ibf->file_header.hash_count; ++i)
+                positions[i] = ibf->hash(value, i) / 64;
+
+            for (size_t word = 0; word < result.raw_data().size(); ++word)
+            {
+                uint64_t hits{~uint64_t{}};
+                for (size_t i = 0; i < ibf->file_header.hash_count; ++i)
+                    hits &= ibf->words[positions[i] + word];
+                result.raw_data()[word] = hits;
+            }
+            return result;
+        }
+
+    private:
+        //!\brief The ibf.
+        mapped_ibf const * ibf{};
+        //!\brief The result of the last query.
+        bin_bitvector result{};
+    };
+
+    //!\brief Returns an agent for queries.
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+
+private:
+    //!\brief The header of the file.
+    mapped_ibf_header file_header{};
+    //!\brief The mapped file.
+    char const * mapped{nullptr};
+    //!\brief The size of the mapped file.
+    size_t mapped_size{};
+    //!\brief The bit data, position p of bin b is bit b % 64 of word (p * technical_bins + b) / 64.
+    uint64_t const * words{nullptr};
+    //!\brief The hash functions of the ibf.
+    ibf_hash hash{};
+
+    //!\brief Unmaps the file.
+    void unmap() noexcept
+    {
+        if (mapped != nullptr)
+            ::munmap(const_cast<char *>(mapped), mapped_size);
+        mapped = nullptr;
+        words = nullptr;
+    }
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+#include "shared.hpp"
+
+/*! \brief A minimal perfect hash function, that maps n distinct keys to 0, ..., n - 1, after BBHash.
+ *  The keys are hashed into a bitvector of gamma * n bits. Keys, that are alone in their bit, get the rank of their
+ *  bit, the others are hashed into the next, smaller level with another hash function. Keys left after the last level
+ *  are stored sorted. A key is found in the first level, in which its bit is set. Other values are mapped to any
+ *  number, they must be compared with the key at that number. About 3 bits per key are needed for gamma = 2.
+ */
+class minimal_perfect_hash
+{
+public:
+    minimal_perfect_hash() = default;
+
+    /*! \brief Construct the function for the given keys.
+     *  \param keys  The keys, which must be distinct.
+     *  \param gamma The bits per key of a level, at least 1. Larger values need more memory, but fewer levels.
+     */
+    explicit minimal_perfect_hash(std::vector<uint64_t> keys, double const gamma = 2.0) :
+        key_count{keys.size()}
+    {
+        std::vector<uint64_t> collided{};
+        for (size_t level = 0; level < max_levels && !keys.empty(); ++level)
+        {
+            uint64_t const bits_of_level = std::ceil(std::max(gamma, 1.0) * keys.size());
+            uint64_t const size = (bits_of_level + 63) / 64 * 64;
+            std::vector<uint64_t> seen(size / 64, 0);
+            std::vector<uint64_t> collisions(size / 64, 0);
+            for (uint64_t const key : keys)
+            {
+                uint64_t const position = position_of(key, level, size);
+                uint64_t const bit = uint64_t{1} << (position % 64);
+                collisions[position / 64] |= seen[position / 64] & bit;
+                seen[position / 64] |= bit;
+            }
+
+            collided.clear();
+            for (uint64_t const key : keys)
+            {
+                uint64_t const position = position_of(key, level, size);
+                if ((collisions[position / 64] >> (position % 64)) & 1)
+                    collided.push_back(key);
+            }
+
+            level_starts.push_back(bits.size() * 64);
+            level_sizes.push_back(size);
+            for (size_t w = 0; w < seen.size(); ++w)
+                bits.push_back(seen[w] & ~collisions[w]);
+            std::swap(keys, collided);
+        }
+
+        std::sort(keys.begin(), keys.end());
+        rest = std::move(keys);
+
+        // The number of set bits before every block of 8 words.
+        ranks.reserve(bits.size() / 8 + 1);
+        uint64_t set_bits{};
+        for (size_t w = 0; w < bits.size(); ++w)
+        {
+            if (w % 8 == 0)
+                ranks.push_back(set_bits);
+            set_bits += std::popcount(bits[w]);
+        }
+        ones = set_bits;
+    }
+
+    //!\brief The number of keys.
+    size_t size() const noexcept
+    {
+        return key_count;
+    }
+
+    //!\brief The memory of the function in bytes.
+    uint64_t bytes() const noexcept
+    {
+        return 8 * (bits.size() + ranks.size() + rest.size() + 2 * level_sizes.size());
+    }
+
+    /*! \brief The number of a key, between 0 and size() - 1.
+     *  \param key The key. For a value, that is not a key, any number less than size() is returned, or size(), if
+     *             there are no keys.
+     */
+    uint64_t operator()(uint64_t const key) const noexcept
+    {
+        for (size_t level = 0; level < level_sizes.size(); ++level)
+        {
+            uint64_t const position = level_starts[level] + position_of(key, level, level_sizes[level]);
+            if ((bits[position / 64] >> (position % 64)) & 1)
+                return rank(position);
+        }
+        auto const found = std::lower_bound(rest.begin(), rest.end(), key);
+        uint64_t const number = ones + (found - rest.begin());
+        return number < key_count ? number : 0;
+    }
+
+    //!\brief Serialises the function with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(key_count, ones, level_starts, level_sizes, bits, ranks, rest);
+    }
+
+private:
+    /*! \brief The number of levels, after which the remaining keys are stored. With gamma = 2, about 40 % of the keys
+     *  collide on every level, so very few keys are left.
+     */
+    static constexpr size_t max_levels{24};
+
+    //!\brief The number of keys.
+    uint64_t key_count{};
+    //!\brief The number of keys found in the levels.
+    uint64_t ones{};
+    //!\brief The first bit of every level.
+    std::vector<uint64_t> level_starts{};
+    //!\brief The number of bits of every level, a multiple of 64.
+    std::vector<uint64_t> level_sizes{};
+    //!\brief The bits of all levels, a bit is set, if exactly one key was hashed to it.
+    std::vector<uint64_t> bits{};
+    //!\brief The number of set bits before every block of 8 words.
+    std::vector<uint64_t> ranks{};
+    //!\brief The sorted keys, that collided on every level.
+    std::vector<uint64_t> rest{};
+
+    //!\brief The number of set bits before a position.
+    uint64_t rank(uint64_t const position) const noexcept
+    {
+        size_t const word = position / 64;
+        uint64_t result = ranks[word / 8];
+        for (size_t w = word / 8 * 8; w < word; ++w)
+            result += std::popcount(bits[w]);
+        return result + std::popcount(bits[word] & ((uint64_t{1} << (position % 64)) - 1));
+    }
+
+    //!\brief The bit of a key in a level of the given size, with a different hash function per level.
+    static uint64_t position_of(uint64_t const key, size_t const level, uint64_t const size) noexcept
+    {
+        uint64_t const h = murmur_mix(key + (level + 1) * 0x9E3779B97F4A7C15ULL);
+        return (static_cast<__uint128_t>(h) * static_cast<__uint128_t>(size)) >> 64;
+    }
+};
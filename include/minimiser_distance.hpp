@@ -14,6 +14,7 @@
 
 #include <seqan3/std/algorithm>
 #include <deque>
+#include <utility>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -34,6 +35,8 @@ namespace seqan3::detail
  * \tparam urng2_t The type of the second underlying range, must model std::ranges::forward_range, the reference type
  *                 must model std::totally_ordered. If only one range is provided this defaults to
  *                 std::ranges::empty_view.
+ * \tparam with_position If true, then not the distances are returned, but the minimisers together with their
+ *                       positions in the underlying range as `std::pair<value, position>`. Default: False.
  * \implements std::ranges::view
  * \ingroup search_views
  *
@@ -46,8 +49,11 @@ namespace seqan3::detail
  * \sa seqan3::views::minimiser_distance
  */
 template <std::ranges::view urng1_t,
-          std::ranges::view urng2_t = std::ranges::empty_view<seqan3::detail::empty_type>>
-class minimiser_distance_view : public std::ranges::view_interface<minimiser_distance_view<urng1_t, urng2_t>>
+          std::ranges::view urng2_t = std::ranges::empty_view<seqan3::detail::empty_type>,
+          bool with_position = false>
+class minimiser_distance_view : public std::ranges::view_interface<minimiser_distance_view<urng1_t,
+                                                                                           urng2_t,
+                                                                                           with_position>>
 {
 private:
     static_assert(std::ranges::forward_range<urng1_t>, "The minimiser_distance_view only works on forward_ranges.");
@@ -230,9 +236,9 @@ public:
 };
 
 //!\brief Iterator for calculating minimiser_distances.
-template <std::ranges::view urng1_t, std::ranges::view urng2_t>
+template <std::ranges::view urng1_t, std::ranges::view urng2_t, bool with_position>
 template <bool const_range>
-class minimiser_distance_view<urng1_t, urng2_t>::basic_iterator
+class minimiser_distance_view<urng1_t, urng2_t, with_position>::basic_iterator
 {
 private:
     //!\brief The sentinel type of the first underlying range.
@@ -251,8 +257,10 @@ public:
      */
     //!\brief Type for distances between iterators.
     using difference_type = std::ranges::range_difference_t<urng1_t>;
-    //!\brief Value type of this iterator.
-    using value_type = std::ranges::range_value_t<urng1_t>;
+    //!\brief Type of the values in the underlying ranges.
+    using hash_type = std::ranges::range_value_t<urng1_t>;
+    //!\brief Value type of this iterator, the minimiser and its position if with_position is true.
+    using value_type = std::conditional_t<with_position, std::pair<hash_type, uint64_t>, hash_type>;
     //!\brief The pointer type.
     using pointer = void;
     //!\brief Reference to `value_type`.
@@ -279,10 +287,14 @@ public:
         requires const_range
     //!\endcond
         : minimiser_distance_value{std::move(it.minimiser_distance_value)},
+          minimiser_value{std::move(it.minimiser_value)},
+          distance{it.distance},
+          minimiser_distance_position_offset{it.minimiser_distance_position_offset},
           urng1_iterator{std::move(it.urng1_iterator)},
           urng1_sentinel{std::move(it.urng1_sentinel)},
           urng2_iterator{std::move(it.urng2_iterator)},
-          window_values{std::move(it.window_values)}
+          window_values{std::move(it.window_values)},
+          position{it.position}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -371,17 +383,20 @@ public:
         return tmp;
     }
 
-    //!\brief Return the minimiser_distance.
+    //!\brief Return the minimiser_distance or the minimiser and its position, if with_position is true.
     value_type operator*() const noexcept
     {
-        return minimiser_distance_value;
+        if constexpr (with_position)
+            return {minimiser_value, position + 1 - window_values.size() + minimiser_distance_position_offset};
+        else
+            return minimiser_distance_value;
     }
 
 private:
     //!\brief The minimiser_distance value.
-    value_type minimiser_distance_value{};
+    hash_type minimiser_distance_value{};
     //!\brief The minimiser value.
-    value_type minimiser_value{};
+    hash_type minimiser_value{};
     //!\brief Helper to track distance.
     size_t distance{};
 
@@ -396,7 +411,10 @@ private:
     urng2_iterator_t urng2_iterator{};
 
     //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser_distance.
-    std::deque<value_type> window_values{};
+    std::deque<hash_type> window_values{};
+
+    //!\brief The position of urng1_iterator in the underlying range. Only relevant, if with_position is true.
+    uint64_t position{};
 
     //!\brief Increments iterator by 1.
     void next_unique_minimiser_distance()
@@ -416,6 +434,7 @@ private:
     //!\brief Advances the window to the next position.
     void advance_window()
     {
+        ++position;
         ++urng1_iterator;
         if constexpr (second_range_is_given)
             ++urng2_iterator;
@@ -433,7 +452,7 @@ private:
             advance_window();
         }
         window_values.push_back(window_value());
-        auto minimiser_distance_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
+        auto minimiser_distance_it = std::ranges::min_element(window_values, std::less_equal<hash_type>{});
         minimiser_value = *minimiser_distance_it;
         minimiser_distance_value = std::distance(std::begin(window_values), minimiser_distance_it);
         minimiser_distance_position_offset = std::distance(std::begin(window_values), minimiser_distance_it);
@@ -452,14 +471,14 @@ private:
         if (urng1_iterator == urng1_sentinel)
             return true;
 
-        value_type const new_value = window_value();
+        hash_type const new_value = window_value();
 
         window_values.pop_front();
         window_values.push_back(new_value);
 
         if (minimiser_distance_position_offset == 0)
         {
-            auto minimiser_distance_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
+            auto minimiser_distance_it = std::ranges::min_element(window_values, std::less_equal<hash_type>{});
             minimiser_distance_value = std::distance(std::begin(window_values), minimiser_distance_it);
             minimiser_distance_position_offset = std::distance(std::begin(window_values), minimiser_distance_it);
             minimiser_value = *minimiser_distance_it;
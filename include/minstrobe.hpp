@@ -13,7 +13,10 @@
 #pragma once
 
 #include <seqan3/std/algorithm>
-#include <deque>
+#include <array>
+#include <bit>
+#include <utility>
+#include <vector>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -21,6 +24,8 @@
 #include <seqan3/utility/range/concept.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
 
+#include "sliding_window_minimum.hpp"
+
 namespace seqan3::detail
 {
 // ---------------------------------------------------------------------------------------------------------------------
@@ -31,19 +36,28 @@ namespace seqan3::detail
  * \tparam urng_t The type of the underlying range, must model std::ranges::forward_range, the reference type must
  *                 model std::totally_ordered. The typical use case is that the reference type is the result of
  *                 seqan3::kmer_hash.
+ * \tparam order  The number of strobes in one minstrobe, either 2 or 3. Default: 2.
+ * \tparam measure_distance If true, then not the actual minstrobes are returned, but the distances between the
+ *                          positions of their second strobes. Default: False.
+ * \tparam with_position If true, every minstrobe is returned together with the position of its first strobe in the
+ *                       underlying range as `std::pair<strobes, position>`. Cannot be combined with measure_distance.
+ *                       Default: False.
  * \implements std::ranges::view
  * \ingroup search_views
  *
  *
  * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
  */
-template <std::ranges::view urng_t>
-class minstrobe_view : public std::ranges::view_interface<minstrobe_view<urng_t>>
+template <std::ranges::view urng_t, uint8_t order = 2, bool measure_distance = false, bool with_position = false>
+class minstrobe_view : public std::ranges::view_interface<minstrobe_view<urng_t, order, measure_distance, with_position>>
 {
 private:
+    static_assert(!(measure_distance && with_position),
+                  "The minstrobe_view can either measure distances or return positions, not both.");
     static_assert(std::ranges::forward_range<urng_t>, "The minstrobe_view only works on forward_ranges.");
     static_assert(std::totally_ordered<std::ranges::range_reference_t<urng_t>>,
                   "The reference type of the underlying range must model std::totally_ordered.");
+    static_assert(order == 2 || order == 3, "The minstrobe_view only supports the orders 2 and 3.");
 
     //!\brief Whether the given ranges are const_iterable.
     static constexpr bool const_iterable = seqan3::const_iterable_range<urng_t>;
@@ -118,7 +132,7 @@ public:
      *
      * ### Complexity
      *
-     * Constant.
+     * Linear in the number of values spanned by one minstrobe.
      *
      * ### Exceptions
      *
@@ -167,9 +181,9 @@ public:
 };
 
 //!\brief Iterator for calculating minstrobes.
-template <std::ranges::view urng_t>
+template <std::ranges::view urng_t, uint8_t order, bool measure_distance, bool with_position>
 template <bool const_range>
-class minstrobe_view<urng_t>::basic_iterator
+class minstrobe_view<urng_t, order, measure_distance, with_position>::basic_iterator
 {
 private:
     //!\brief The sentinel type of the underlying range.
@@ -188,8 +202,15 @@ public:
     using difference_type = std::ranges::range_difference_t<urng_t>;
     //!\brief Value type of the iterator.
     using value_t = std::ranges::range_value_t<urng_t>;
-    //!\brief Value type of the output.
-    using value_type = std::vector<value_t>;
+    //!\brief The strobes of one minstrobe.
+    using strobes_type = std::array<value_t, order>;
+    //!\brief Value type of the output, a distance if measure_distance is true and paired with the position if
+    //!       with_position is true.
+    using value_type = std::conditional_t<measure_distance,
+                                          size_t,
+                                          std::conditional_t<with_position,
+                                                             std::pair<strobes_type, uint64_t>,
+                                                             strobes_type>>;
     //!\brief The pointer type.
     using pointer = void;
     //!\brief Reference to `value_type`.
@@ -216,37 +237,42 @@ public:
         requires const_range
     //!\endcond
         : minstrobe_value{std::move(it.minstrobe_value)},
-          second_iterator{std::move(it.second_iterator)},
-          urng_sentinel{std::move(it.urng_sentinel)}
-
+          urng_iterator{std::move(it.urng_iterator)},
+          urng_sentinel{std::move(it.urng_sentinel)},
+          ring_buffer{std::move(it.ring_buffer)},
+          ring_mask{std::move(it.ring_mask)},
+          ring_head{std::move(it.ring_head)},
+          window_min{std::move(it.window_min)},
+          window_max{std::move(it.window_max)},
+          windows{std::move(it.windows)},
+          position{it.position},
+          last_second_position{it.last_second_position}
     {}
 
-    /*!\brief Construct from two begin and one end iterators of a given range over std::totally_ordered values, and the two
-    *         (lower and upper) offsets of the second window.
-    * \param[in] second_iterator Iterator pointing to the first position of the second window of the std::totally_ordered range.
-    * \param[in] urng_sentinel   Iterator pointing to the last position of the second window of the std::totally_ordered range.
+    /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the two
+    *         (lower and upper) offsets of the next window.
+    * \param[in] urng_iterator   Iterator pointing to the first position of the std::totally_ordered range.
+    * \param[in] urng_sentinel   Iterator pointing to the last position of the std::totally_ordered range.
     * \param[in] window_min      The lower offset for the position of the next window from the previous one.
     * \param[in] window_max      The upper offset for the position of the next window from the previous one.
     *
     * \details
     *
-    * Looks at the number of values per two windows with three iterators. First iterator adds the next value in the vector as
-    * the first strobe. The second iterator adds the minimum value of the second window to the second position of the vector.
-    *
+    * Fills a ring buffer with all values spanned by the first minstrobe and one sliding window minimum per window.
+    * Afterwards, the underlying iterator always points to the last value of the last window, so every increment reads
+    * exactly one new value. If the range is too short to contain a single minstrobe, the iterator is equal to the
+    * sentinel.
     */
-    basic_iterator(urng_iterator_t second_iterator,
+    basic_iterator(urng_iterator_t urng_iterator,
                    urng_sentinel_t urng_sentinel,
                    size_t window_min,
                    size_t window_max) :
-        first_iterator{std::move(first_iterator)},
-        second_iterator{std::move(second_iterator)},
-        urng_sentinel{std::move(urng_sentinel)}
+        urng_iterator{std::move(urng_iterator)},
+        urng_sentinel{std::move(urng_sentinel)},
+        window_min{window_min},
+        window_max{window_max}
     {
-        size_t size = std::ranges::distance(second_iterator, urng_sentinel);
-        if (window_max + 1 > size)
-            throw std::invalid_argument{"The given sequence is too short to satisfy the given parameters.\n"
-                                        "Please choose a smaller window min and max."};
-        window_first(window_min, window_max);
+        window_first();
     }
     //!\}
 
@@ -257,7 +283,7 @@ public:
     //!\brief Compare to another basic_iterator.
     friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
     {
-        return (lhs.second_iterator == rhs.second_iterator);
+        return (lhs.urng_iterator == rhs.urng_iterator);
     }
 
     //!\brief Compare to another basic_iterator.
@@ -269,7 +295,7 @@ public:
     //!\brief Compare to the sentinel of the minstrobe_view.
     friend bool operator==(basic_iterator const & lhs, sentinel const &)
     {
-        return lhs.second_iterator == lhs.urng_sentinel;
+        return lhs.urng_iterator == lhs.urng_sentinel;
     }
 
     //!\brief Compare to the sentinel of the minstrobe_view.
@@ -294,7 +320,7 @@ public:
     //!\brief Pre-increment.
     basic_iterator & operator++() noexcept
     {
-        next_minstrobe();
+        next_unique_minstrobe();
         return *this;
     }
 
@@ -302,7 +328,7 @@ public:
     basic_iterator operator++(int) noexcept
     {
         basic_iterator tmp{*this};
-        next_minstrobe();
+        next_unique_minstrobe();
         return tmp;
     }
 
@@ -316,107 +342,155 @@ private:
     //!\brief The minstrobe value.
     value_type minstrobe_value{};
 
-    //!\brief The offset relative to the beginning of the window where the minstrobe value is found.
-    size_t minstrobe_position_offset{};
-
-    //!\brief Iterator to the first strobe of minstrobe.
-    urng_iterator_t first_iterator{};
-
-    //!\brief Iterator to the right most value of the window and hence the second strobe of minstrobe.
-    urng_iterator_t second_iterator{};
+    //!\brief Iterator to the right most value of the last window.
+    urng_iterator_t urng_iterator{};
 
     //!\brief Iterator to last element in range.
     urng_sentinel_t urng_sentinel{};
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minstrobe.
-    std::deque<value_t> window_values{};
+    //!\brief Stores the values spanned by one minstrobe. Its size is a power of two, so indices wrap with a mask.
+    std::vector<value_t> ring_buffer{};
+
+    //!\brief The mask used to wrap indices of the ring buffer.
+    size_t ring_mask{};
 
-    //!\brief The number of values in one window.
-    size_t window_size{};
+    //!\brief The index of the first strobe in the ring buffer.
+    size_t ring_head{};
 
-    //!\brief Advances the window of the first iterator to the next position.
-    void advance_windows()
+    //!\brief lower offset for the position of the next window.
+    size_t window_min{};
+
+    //!\brief upper offset for the position of the next window.
+    size_t window_max{};
+
+    //!\brief The minima of the windows of all but the first strobe, each kept in a monotone queue.
+    std::array<sliding_window_minimum<value_t>, order - 1> windows{};
+
+    //!\brief The position of the first strobe in the underlying range. Only relevant, if with_position is true.
+    uint64_t position{};
+
+    //!\brief The position of the last second strobe, whose distance was reported. Only relevant, if measure_distance
+    //!       is true.
+    size_t last_second_position{};
+
+    //!\brief Returns the value at the given offset from the first strobe.
+    value_t value_at(size_t const offset) const noexcept
     {
-        ++first_iterator;
-        ++second_iterator;
+        return ring_buffer[(ring_head + offset) & ring_mask];
     }
 
-    //!\brief Calculates minstrobes for the first window.
-    void window_first(const size_t window_min, const size_t window_max)
+    //!\brief Fills the ring buffer and the window minima with the values of the first minstrobe.
+    void window_first()
     {
-        window_size = (window_max - window_min + 1);
+        size_t const span = (order - 1) * window_max + 1;
+        ring_buffer.resize(std::bit_ceil(span));
+        ring_mask = ring_buffer.size() - 1;
 
-        if (window_size == 0u)
-            return;
+        for (size_t i = 0; i < span; ++i)
+        {
+            if (urng_iterator == urng_sentinel)
+                return;
+
+            ring_buffer[i] = *urng_iterator;
 
-        first_iterator = second_iterator;
-        std::advance(second_iterator, window_min);
+            if (i + 1 < span)
+                ++urng_iterator;
+        }
 
-        for (int i = 1u; i < window_size; ++i)
+        for (size_t strobe = 1; strobe < order; ++strobe)
         {
-            window_values.push_back(*second_iterator);
-            ++second_iterator;
+            auto & window = windows[strobe - 1];
+            window = sliding_window_minimum<value_t>{window_max - window_min + 1};
+            for (size_t offset = (strobe - 1) * window_max + window_min; offset <= strobe * window_max; ++offset)
+                window.push(value_at(offset));
         }
-        window_values.push_back(*second_iterator);
 
-        auto minstrobe_it = std::ranges::min_element(window_values, std::less_equal<value_t>{});
-        minstrobe_value = {*first_iterator, *minstrobe_it};
-        minstrobe_position_offset = std::distance(std::begin(window_values), minstrobe_it);
+        // The reported distance of the first second strobe is measured from the first possible position.
+        last_second_position = window_min - 1;
+        select_strobes();
+    }
+
+    /*!\brief Stores the first strobe and the current minima of the windows as minstrobe.
+     * \returns True, if a new value is stored. Otherwise returns false, which can only happen, if measure_distance
+     *          is true and the second strobe did not change.
+     */
+    bool select_strobes() noexcept
+    {
+        if constexpr (measure_distance)
+        {
+            // The window of the second strobe started at offset window_min, when the first value was pushed.
+            size_t const second_position = window_min + windows[0].min_position();
+            if (second_position <= last_second_position)
+                return false;
+
+            minstrobe_value = second_position - last_second_position - 1;
+            last_second_position = second_position;
+        }
+        else
+        {
+            strobes_type & strobes = strobes_of(minstrobe_value);
+            strobes[0] = value_at(0);
+            for (size_t strobe = 1; strobe < order; ++strobe)
+                strobes[strobe] = windows[strobe - 1].min_value();
+
+            if constexpr (with_position)
+                minstrobe_value.second = position;
+        }
+        return true;
+    }
+
+    //!\brief Returns the strobes of the given minstrobe value.
+    static strobes_type & strobes_of(value_type & value) noexcept
+    {
+        if constexpr (with_position)
+            return value.first;
+        else
+            return value;
     }
 
     /*!\brief Calculates the next minstrobe value.
+     * \returns True, if a new value is stored or the end is reached. Otherwise returns false.
      * \details
-     * For the following windows, we remove the first window value (is now not in window_values) and add the new
-     * value that results from the window shifting.
+     * All windows shift by one position, so every window minimum receives the value that follows its last value.
+     * This costs amortized constant time per window.
      */
-    void next_minstrobe()
+    bool next_minstrobe()
     {
-        advance_windows();
+        ++urng_iterator;
 
-        if (second_iterator == urng_sentinel)
-            return;
-        value_t const new_value = *first_iterator;
-        value_t const sw_new_value = *second_iterator;
+        if (urng_iterator == urng_sentinel)
+            return true;
 
-        minstrobe_value[0]= new_value;
+        ++position;
+        ring_head = (ring_head + 1) & ring_mask;
+        ring_buffer[(ring_head + (order - 1) * window_max) & ring_mask] = *urng_iterator;
 
-        window_values.pop_front();
-        window_values.push_back(sw_new_value);
+        for (size_t strobe = 1; strobe < order; ++strobe)
+            windows[strobe - 1].push(value_at(strobe * window_max));
 
-        if (sw_new_value < minstrobe_value[1])
-        {
-            minstrobe_value[1] = sw_new_value;
-            minstrobe_position_offset = window_values.size() - 1;
-            return;
-        }
-
-        else if (minstrobe_position_offset == 0)
-        {
-            auto minstrobe_it = std::ranges::min_element(window_values, std::less_equal<value_t>{});
-            minstrobe_value[1] = *minstrobe_it;
-            minstrobe_position_offset = std::distance(std::begin(window_values), minstrobe_it);
-            return;
-        }
+        return select_strobes();
+    }
 
-        --minstrobe_position_offset;
+    //!\brief Increments the iterator until a new value is stored or the end is reached.
+    void next_unique_minstrobe()
+    {
+        while (!next_minstrobe()) {}
     }
 };
 
-
-
 //!\brief A deduction guide for the view class template.
 template <std::ranges::viewable_range rng_t>
 minstrobe_view(rng_t &&, size_t const window_min, size_t const window_max) -> minstrobe_view<std::views::all_t<rng_t>>;
 
-
-
 // ---------------------------------------------------------------------------------------------------------------------
 // minstrobe_fn (adaptor definition)
 // ---------------------------------------------------------------------------------------------------------------------
 
 //![adaptor_def]
 //!\brief minstrobe's range adaptor object type (non-closure).
+//!\tparam order The number of strobes in one minstrobe, either 2 or 3.
 //!\ingroup search_views
+template <uint8_t order>
 struct minstrobe_fn
 {
     //!\brief Store the number of values in two windows and return a range adaptor closure object.
@@ -432,7 +506,7 @@ struct minstrobe_fn
      *                        std::ranges::forward_range.
      * \param[in] window_min  The lower offset for the position of the next window from the previous one.
      * \param[in] window_max  The upper offset for the position of the next window from the previous one.
-     * \returns  A range of the converted values in vectors of size 2.
+     * \returns  A range of the converted values in arrays of size `order`.
      */
     template <std::ranges::range urng_t>
     constexpr auto operator()(urng_t && urange, size_t const window_min, size_t const window_max) const
@@ -446,7 +520,7 @@ struct minstrobe_fn
             throw std::invalid_argument{"The chosen min and max windows are not valid."
                                         "Please choose a window_max greater than window_min."};
 
-        return minstrobe_view{urange, window_min, window_max};
+        return minstrobe_view<std::views::all_t<urng_t>, order>{std::forward<urng_t>(urange), window_min, window_max};
     }
 };
 //![adaptor_def]
@@ -462,7 +536,7 @@ namespace seqan3::views
  * \param[in] urange The range being processed. [parameter is omitted in pipe notation]
  * \param[in] window_min  The lower offset for the position of the next window from the previous one.
  * \param[in] window_max  The upper offset for the position of the next window from the previous one.
- * \returns A range of std::totally_ordered where each value is a vector of size 2. See below for the
+ * \returns A range of std::totally_ordered where each value is an array of size 2. See below for the
  *          properties of the returned range.
  * \ingroup search_views
  *
@@ -473,6 +547,9 @@ namespace seqan3::views
  * For example for the following list of hash values `[6, 26, 41, 38, 24, 33, 6, 27, 47]` and 3 as `window_min`,
  * 5 as `window_max`, the minstrobe values are `[(6,24),(26,6),(41,6),(38,6)]`.
  *
+ * The minimum of every window is kept in a monotone queue, so every minstrobe is computed in amortized constant time.
+ * Sequences shorter than one minstrobe result in an empty range.
+ *
  * ### View properties
  *
  * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
@@ -490,10 +567,25 @@ namespace seqan3::views
  * | std::ranges::output_range        |                                    | *lost*                           |
  * | seqan3::const_iterable_range     |                                    | *preserved*                      |
  * |                                  |                                    |                                  |
- * | std::ranges::range_reference_t   | std::totally_ordered               | std::totally_ordered             |
+ * | std::ranges::range_reference_t   | std::totally_ordered               | std::array                       |
  *
  * See the views views submodule documentation for detailed descriptions of the view properties.
  */
-inline constexpr auto minstrobe = detail::minstrobe_fn{};
+inline constexpr auto minstrobe = detail::minstrobe_fn<2>{};
+
+/*!\brief Computes minstrobes of order 3 for a range of comparable values. The second strobe is the minimum of the
+ *        window with the offsets `[window_min, window_max]` and the third strobe the minimum of the window with the
+ *        offsets `[window_max + window_min, 2 * window_max]` relative to the first strobe.
+ * \returns A range of std::totally_ordered where each value is an array of size 3.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * For example for the following list of hash values `[6, 26, 41, 38, 24, 33, 6, 27, 47]` and 2 as `window_min`,
+ * 3 as `window_max`, the minstrobe values are `[(6,38,6),(26,24,6),(41,24,27)]`.
+ *
+ * See seqan3::views::minstrobe for the properties of the returned range.
+ */
+inline constexpr auto minstrobe3 = detail::minstrobe_fn<3>{};
 
 } // namespace seqan3::views
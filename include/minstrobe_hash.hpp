@@ -20,16 +20,12 @@
 #include "minstrobe.hpp"
 #include "shared.hpp"
 
-
-uint64_t combine_strobes(uint64_t multiplicator, uint64_t first_strobe, uint64_t second_strobe)
-{
-    return first_strobe*multiplicator + second_strobe;
-}
-
 namespace seqan3::detail
 {
 //!\brief seqan3::views::minstrobe_hash's range adaptor object type (non-closure).
+//!\tparam order The number of strobes in one minstrobe, either 2 or 3.
 //!\ingroup search_views
+template <uint8_t order>
 struct minstrobe_hash_fn
 {
     /*!\brief Store the shape and the window min and max offsets and return a range adaptor closure object.
@@ -37,7 +33,7 @@ struct minstrobe_hash_fn
     * \param[in] window_min  The lower offset for the position of the next window from the previous one.
     * \param[in] window_max  The upper offset for the position of the next window from the previous one.
     * \throws std::invalid_argument if window_min is greater than window_max or smaller than 1.
-    * \returns               A range of converted elements in vectors of size 2.
+    * \returns               A range of converted elements.
     */
     constexpr auto operator()(shape const & shape, uint32_t const window_min, uint32_t const window_max) const
     {
@@ -50,7 +46,7 @@ struct minstrobe_hash_fn
     * \param[in] window_max  The upper offset for the position of the next window from the previous one.
     * \param[in] seed        The seed to use.
     * \throws std::invalid_argument if window_min is greater than window_max or smaller than 1.
-    * \returns               A range of converted elements in vectors of size 2.
+    * \returns               A range of converted elements.
     */
     constexpr auto operator()(shape const & shape, uint32_t const window_min, uint32_t const window_max, seed const seed) const
     {
@@ -65,7 +61,7 @@ struct minstrobe_hash_fn
      * \param[in] window_max  The upper offset for the position of the next window from the previous one.
      * \param[in] seed        The seed to use.
      * \throws std::invalid_argument if window_min is greater than window_max or smaller than 1.
-     * \returns               A range of converted elements in vectors of size 2.
+     * \returns               A range of converted elements.
      */
     template <std::ranges::range urng_t>
     constexpr auto operator()(urng_t && urange,
@@ -89,10 +85,12 @@ struct minstrobe_hash_fn
                                                           | std::views::transform([seed] (uint64_t i)
                                                                                   {return i ^ seed.get();});
 
-        auto minstrobes = seqan3::detail::minstrobe_view(hashed_values, window_min, window_max);
-        uint64_t multiplicator = std::pow(4,shape.size());
-        return std::views::transform(minstrobes, [multiplicator] (std::vector<uint64_t> i)
-                               {return combine_strobes(multiplicator, i[0], i[1]);});
+        auto minstrobes = seqan3::detail::minstrobe_view<decltype(hashed_values), order>(hashed_values,
+                                                                                         window_min,
+                                                                                         window_max);
+        uint64_t multiplicator = strobe_multiplicator(shape.size());
+        return std::views::transform(minstrobes, [multiplicator] (std::array<uint64_t, order> const & i)
+                               {return combine_strobes(multiplicator, i);});
     }
 };
 
@@ -110,8 +108,8 @@ struct minstrobe_hash_fn
  * \param[in] window_min     The lower offset for the position of the next window from the previous one.
  * \param[in] window_max     The upper offset for the position of the next window from the previous one.
  * \param[in] seed           The seed used to skew the hash values. Default: 0x8F3F73B5CF1C9ADE.
- * \returns                  A range of `size_t` where each value is a vector composed of two minstrobes.
- *                           See below for the properties of the returned range.
+ * \returns                  A range of `size_t` where each value is the combined hash of the two strobes of one
+ *                           minstrobe. See below for the properties of the returned range.
  * \ingroup search_views
  *
  * \attention
@@ -142,6 +140,20 @@ struct minstrobe_hash_fn
  * \hideinitializer
  *
  */
-inline constexpr auto minstrobe_hash = seqan3::detail::minstrobe_hash_fn{};
+inline constexpr auto minstrobe_hash = seqan3::detail::minstrobe_hash_fn<2>{};
+
+/*!\brief                    Computes minstrobes of order 3 for a range with a given shape, min and max window offsets
+ *                           and seed.
+ * \returns                  A range of `size_t` where each value is the combined hash of the three strobes of one
+ *                           minstrobe.
+ * \ingroup search_views
+ *
+ * \details
+ * The windows of the second and third strobe are given by seqan3::views::minstrobe3. See minstrobe_hash for the
+ * parameters and the properties of the returned range.
+ *
+ * \hideinitializer
+ */
+inline constexpr auto minstrobe3_hash = seqan3::detail::minstrobe_hash_fn<3>{};
 
 //!\}
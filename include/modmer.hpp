@@ -14,6 +14,7 @@
 
 #include <seqan3/std/algorithm>
 #include <deque>
+#include <utility>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -32,6 +33,8 @@ namespace seqan3::detail
  *                 model std::totally_ordered. The typical use case is that the reference type is the result of
  *                 seqan3::kmer_hash.
  * \tparam measure_distance If true, then not the actual modmers are returned, but the distances of the modmers.
+ * \tparam with_position If true, every modmer is returned together with its position in the underlying range as
+ *                       `std::pair<value, position>`. Cannot be combined with measure_distance.
  * \implements std::ranges::view
  * \ingroup search_views
  *
@@ -39,10 +42,12 @@ namespace seqan3::detail
  * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
 
  */
-template <std::ranges::view urng1_t, bool measure_distance = false>
-class modmer_view : public std::ranges::view_interface<modmer_view<urng1_t>>
+template <std::ranges::view urng1_t, bool measure_distance = false, bool with_position = false>
+class modmer_view : public std::ranges::view_interface<modmer_view<urng1_t, measure_distance, with_position>>
 {
 private:
+    static_assert(!(measure_distance && with_position),
+                  "The modmer_view can either measure distances or return positions, but not both.");
     static_assert(std::ranges::forward_range<urng1_t>, "The modmer_view only works on forward_ranges.");
     static_assert(std::totally_ordered<std::ranges::range_reference_t<urng1_t>>,
                   "The reference type of the underlying range must model std::totally_ordered.");
@@ -159,9 +164,9 @@ public:
 };
 
 //!\brief Iterator for calculating modmers.
-template <std::ranges::view urng1_t, bool measure_distance>
+template <std::ranges::view urng1_t, bool measure_distance, bool with_position>
 template <bool const_range>
-class modmer_view<urng1_t, measure_distance>::basic_iterator
+class modmer_view<urng1_t, measure_distance, with_position>::basic_iterator
 {
 private:
     //!\brief The sentinel type of the first underlying range.
@@ -178,8 +183,10 @@ public:
      */
     //!\brief Type for distances between iterators.
     using difference_type = std::ranges::range_difference_t<urng1_t>;
-    //!\brief Value type of this iterator.
-    using value_type = std::ranges::range_value_t<urng1_t>;
+    //!\brief Value type of this iterator, paired with the position if with_position is true.
+    using value_type = std::conditional_t<with_position,
+                                          std::pair<std::ranges::range_value_t<urng1_t>, uint64_t>,
+                                          std::ranges::range_value_t<urng1_t>>;
     //!\brief The pointer type.
     using pointer = void;
     //!\brief Reference to `value_type`.
@@ -207,7 +214,10 @@ public:
     //!\endcond
         : modmer_value{std::move(it.modmer_value)},
           urng1_iterator{std::move(it.urng1_iterator)},
-          urng1_sentinel{std::move(it.urng1_sentinel)}
+          urng1_sentinel{std::move(it.urng1_sentinel)},
+          mod{it.mod},
+          distance{it.distance},
+          position{it.position}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -311,11 +321,14 @@ private:
     size_t mod{};
     //!brief The distance stored. Only relevant, if measure_distance is true.
     size_t distance{1};
+    //!brief The position of urng1_iterator in the underlying range. Only relevant, if with_position is true.
+    uint64_t position{};
 
     //!\brief Advances the window to the next position.
     void advance()
     {
         distance++;
+        ++position;
         ++urng1_iterator;
     }
 
@@ -351,6 +364,10 @@ private:
                 modmer_value = distance - 1;
                 distance = 0;
             }
+            else if constexpr (with_position)
+            {
+                modmer_value = {*urng1_iterator, position};
+            }
             else
             {
                 modmer_value = *urng1_iterator;
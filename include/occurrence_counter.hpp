@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "shared.hpp"
+
+/*! \brief Counts the occurrences of the values of a read, e.g. of its minimisers, to look up every value only once.
+ *  The values are kept in an open-addressing hash table with linear probing, that is sized to twice the number of
+ *  values of the read. The memory is reused for the next read.
+ */
+class occurrence_counter
+{
+public:
+    occurrence_counter() = default;
+
+    /*! \brief Counts the occurrences of the values, replacing the result of the last call.
+     *  \param values The values.
+     */
+    void count(std::vector<uint64_t> const & values)
+    {
+        distinct.clear();
+        occurrences.clear();
+        size_t const capacity = std::bit_ceil(std::max<size_t>(16, 2 * values.size()));
+        size_t const mask = capacity - 1;
+        slots.assign(capacity, 0);
+
+        for (uint64_t const value : values)
+        {
+            size_t slot = murmur_mix(value) & mask;
+            // A slot holds the index of its value in distinct plus one, 0 marks an empty slot.
+            while (slots[slot] != 0 && distinct[slots[slot] - 1] != value)
+                slot = (slot + 1) & mask;
+
+            if (slots[slot] == 0)
+            {
+                distinct.push_back(value);
+                occurrences.push_back(0);
+                slots[slot] = distinct.size();
+            }
+            ++occurrences[slots[slot] - 1];
+        }
+    }
+
+    //!\brief The distinct values in the order of their first occurrence.
+    std::vector<uint64_t> const & values() const noexcept
+    {
+        return distinct;
+    }
+
+    //!\brief The number of occurrences of every distinct value, in the same order.
+    std::vector<uint64_t> const & counts() const noexcept
+    {
+        return occurrences;
+    }
+
+private:
+    //!\brief The distinct values.
+    std::vector<uint64_t> distinct{};
+    //!\brief The number of occurrences of the distinct values.
+    std::vector<uint64_t> occurrences{};
+    //!\brief The hash table.
+    std::vector<size_t> slots{};
+};
@@ -0,0 +1,530 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides randstrobe.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/range/detail/adaptor_from_functor.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/utility/range/concept.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// randstrobe_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by randstrobe.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::forward_range, the reference type must
+ *                 model std::unsigned_integral. The typical use case is that the reference type is the result of
+ *                 seqan3::kmer_hash.
+ * \tparam order  The number of strobes in one randstrobe, either 2 or 3. Default: 2.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ *
+ * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t, uint8_t order = 2>
+class randstrobe_view : public std::ranges::view_interface<randstrobe_view<urng_t, order>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The randstrobe_view only works on forward_ranges.");
+    static_assert(std::unsigned_integral<std::ranges::range_value_t<urng_t>>,
+                  "The value type of the underlying range must model std::unsigned_integral.");
+    static_assert(order == 2 || order == 3, "The randstrobe_view only supports the orders 2 and 3.");
+
+    //!\brief Whether the given ranges are const_iterable.
+    static constexpr bool const_iterable = seqan3::const_iterable_range<urng_t>;
+
+    //!\brief The underlying range.
+    urng_t urange{};
+
+    //!\brief lower offset for the position of the next window.
+    size_t window_min{};
+
+    //!\brief upper offset for the position of the next window.
+    size_t window_max{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+    //!\brief The sentinel type of the randstrobe_view.
+    using sentinel = std::default_sentinel_t;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+     /// \cond Workaround_Doxygen
+    randstrobe_view() requires std::default_initializable<urng_t> = default; //!< Defaulted.
+    /// \endcond
+    randstrobe_view(randstrobe_view const & rhs) = default; //!< Defaulted.
+    randstrobe_view(randstrobe_view && rhs) = default; //!< Defaulted.
+    randstrobe_view & operator=(randstrobe_view const & rhs) = default; //!< Defaulted.
+    randstrobe_view & operator=(randstrobe_view && rhs) = default; //!< Defaulted.
+    ~randstrobe_view() = default; //!< Defaulted.
+
+    /*!\brief Construct from a view and the two (lower and upper) offsets of the next window.
+    * \param[in] urange     The input range to process. Must model std::ranges::viewable_range and
+    *                        std::ranges::forward_range.
+    * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+    */
+    randstrobe_view(urng_t urange, size_t const window_min, size_t const window_max) :
+        urange{std::move(urange)},
+        window_min{window_min},
+        window_max{window_max}
+    {}
+
+    /*!\brief Construct from a non-view that can be view-wrapped and the two (lower and upper) offsets
+    *        of the next window.
+    * \tparam other_urng_t   The type of another urange. Must model std::ranges::viewable_range and be
+                             constructible from urng_t.
+    * \param[in] urange     The input range to process. Must model std::ranges::viewable_range and
+    *                        std::ranges::forward_range.
+    * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+    */
+    template <typename other_urng_t>
+    //!\cond
+        requires (std::ranges::viewable_range<other_urng_t> &&
+                  std::constructible_from<urng_t, ranges::ref_view<std::remove_reference_t<other_urng_t>>>)
+    //!\endcond
+    randstrobe_view(other_urng_t && urange, size_t const window_min, size_t const window_max) :
+        urange{std::views::all(std::forward<other_urng_t>(urange))},
+        window_min{window_min},
+        window_max{window_max}
+    {}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of values spanned by one randstrobe.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee.
+     */
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(urange),
+                std::ranges::end(urange),
+                window_min,
+                window_max};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+    //!\cond
+        requires const_iterable
+    //!\endcond
+    {
+        return {std::ranges::cbegin(urange),
+                std::ranges::cend(urange),
+                window_min,
+                window_max};
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the range.
+     * \returns Iterator to the end.
+     *
+     * \details
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    sentinel end() const
+    {
+        return {};
+    }
+    //!\}
+};
+
+//!\brief Iterator for calculating randstrobes.
+template <std::ranges::view urng_t, uint8_t order>
+template <bool const_range>
+class randstrobe_view<urng_t, order>::basic_iterator
+{
+private:
+    //!\brief The sentinel type of the underlying range.
+    using urng_sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_t = maybe_const_iterator_t<const_range, urng_t>;
+
+    template <bool>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ranges::range_difference_t<urng_t>;
+    //!\brief Value type of the iterator.
+    using value_t = std::ranges::range_value_t<urng_t>;
+    //!\brief Value type of the output.
+    using value_type = std::array<value_t, order>;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default; //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default; //!< Defaulted.
+    ~basic_iterator() = default; //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+    //!\cond
+        requires const_range
+    //!\endcond
+        : randstrobe_value{std::move(it.randstrobe_value)},
+          urng_iterator{std::move(it.urng_iterator)},
+          urng_sentinel{std::move(it.urng_sentinel)},
+          ring_buffer{std::move(it.ring_buffer)},
+          ring_mask{std::move(it.ring_mask)},
+          ring_head{std::move(it.ring_head)},
+          window_min{std::move(it.window_min)},
+          window_max{std::move(it.window_max)}
+    {}
+
+    /*!\brief Construct from begin and end iterators of a given range over std::unsigned_integral values, and the two
+    *         (lower and upper) offsets of the next window.
+    * \param[in] urng_iterator   Iterator pointing to the first position of the std::unsigned_integral range.
+    * \param[in] urng_sentinel   Iterator pointing to the last position of the std::unsigned_integral range.
+    * \param[in] window_min      The lower offset for the position of the next window from the previous one.
+    * \param[in] window_max      The upper offset for the position of the next window from the previous one.
+    *
+    * \details
+    *
+    * Fills a ring buffer with all values spanned by the first randstrobe. Afterwards, the underlying iterator always
+    * points to the last value of the last window, so every increment reads exactly one new value. If the range is
+    * too short to contain a single randstrobe, the iterator is equal to the sentinel.
+    */
+    basic_iterator(urng_iterator_t urng_iterator,
+                   urng_sentinel_t urng_sentinel,
+                   size_t window_min,
+                   size_t window_max) :
+        urng_iterator{std::move(urng_iterator)},
+        urng_sentinel{std::move(urng_sentinel)},
+        window_min{window_min},
+        window_max{window_max}
+    {
+        window_first();
+    }
+    //!\}
+
+    //!\anchor basic_iterator_comparison_randstrobe
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return (lhs.urng_iterator == rhs.urng_iterator);
+    }
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the randstrobe_view.
+    friend bool operator==(basic_iterator const & lhs, sentinel const &)
+    {
+        return lhs.urng_iterator == lhs.urng_sentinel;
+    }
+
+    //!\brief Compare to the sentinel of the randstrobe_view.
+    friend bool operator==(sentinel const & lhs, basic_iterator const & rhs)
+    {
+        return rhs == lhs;
+    }
+
+    //!\brief Compare to the sentinel of the randstrobe_view.
+    friend bool operator!=(sentinel const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the randstrobe_view.
+    friend bool operator!=(basic_iterator const & lhs, sentinel const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        next_randstrobe();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+    {
+        basic_iterator tmp{*this};
+        next_randstrobe();
+        return tmp;
+    }
+
+    //!\brief Return the randstrobe.
+    value_type operator*() const noexcept
+    {
+        return randstrobe_value;
+    }
+
+private:
+    //!\brief The mask applied to the sum of the previous strobes and a candidate to select the next strobe.
+    static constexpr value_t selection_mask{0xFFFF};
+
+    //!\brief The randstrobe value.
+    value_type randstrobe_value{};
+
+    //!\brief Iterator to the right most value of the last window.
+    urng_iterator_t urng_iterator{};
+
+    //!\brief Iterator to last element in range.
+    urng_sentinel_t urng_sentinel{};
+
+    //!\brief Stores the values spanned by one randstrobe. Its size is a power of two, so indices wrap with a mask.
+    std::vector<value_t> ring_buffer{};
+
+    //!\brief The mask used to wrap indices of the ring buffer.
+    size_t ring_mask{};
+
+    //!\brief The index of the first strobe in the ring buffer.
+    size_t ring_head{};
+
+    //!\brief lower offset for the position of the next window.
+    size_t window_min{};
+
+    //!\brief upper offset for the position of the next window.
+    size_t window_max{};
+
+    //!\brief Returns the value at the given offset from the first strobe.
+    value_t value_at(size_t const offset) const noexcept
+    {
+        return ring_buffer[(ring_head + offset) & ring_mask];
+    }
+
+    //!\brief Fills the ring buffer with the values of the first randstrobe.
+    void window_first()
+    {
+        size_t const span = (order - 1) * window_max + 1;
+        ring_buffer.resize(std::bit_ceil(span));
+        ring_mask = ring_buffer.size() - 1;
+
+        for (size_t i = 0; i < span; ++i)
+        {
+            if (urng_iterator == urng_sentinel)
+                return;
+
+            ring_buffer[i] = *urng_iterator;
+
+            if (i + 1 < span)
+                ++urng_iterator;
+        }
+
+        select_strobes();
+    }
+
+    /*!\brief Selects the strobes of the current randstrobe.
+     * \details
+     * The first strobe is the value at the current position. Every following strobe is the value in its window, that
+     * minimises the sum of all previous strobes and itself masked by `selection_mask`. If several values share the
+     * minimum, the leftmost one is chosen.
+     */
+    void select_strobes()
+    {
+        value_t previous = value_at(0);
+        randstrobe_value[0] = previous;
+
+        for (size_t strobe = 1; strobe < order; ++strobe)
+        {
+            size_t const window_begin = (strobe - 1) * window_max + window_min;
+            size_t const window_end = strobe * window_max;
+
+            value_t best_value = value_at(window_begin);
+            value_t best_score = (previous + best_value) & selection_mask;
+            for (size_t offset = window_begin + 1; offset <= window_end; ++offset)
+            {
+                value_t const candidate = value_at(offset);
+                value_t const score = (previous + candidate) & selection_mask;
+                if (score < best_score)
+                {
+                    best_score = score;
+                    best_value = candidate;
+                }
+            }
+
+            randstrobe_value[strobe] = best_value;
+            previous += best_value;
+        }
+    }
+
+    /*!\brief Calculates the next randstrobe value.
+     * \details
+     * The oldest value in the ring buffer belongs to the previous first strobe and is overwritten by the new value
+     * that results from shifting the last window.
+     */
+    void next_randstrobe()
+    {
+        ++urng_iterator;
+
+        if (urng_iterator == urng_sentinel)
+            return;
+
+        ring_head = (ring_head + 1) & ring_mask;
+        ring_buffer[(ring_head + (order - 1) * window_max) & ring_mask] = *urng_iterator;
+
+        select_strobes();
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+randstrobe_view(rng_t &&, size_t const window_min, size_t const window_max) -> randstrobe_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// randstrobe_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//![adaptor_def]
+//!\brief randstrobe's range adaptor object type (non-closure).
+//!\tparam order The number of strobes in one randstrobe, either 2 or 3.
+//!\ingroup search_views
+template <uint8_t order>
+struct randstrobe_fn
+{
+    //!\brief Store the two window offsets and return a range adaptor closure object.
+    constexpr auto operator()(const size_t window_min, const size_t window_max) const
+    {
+        return adaptor_from_functor{*this, window_min, window_max};
+    }
+
+    /*!\brief Call the view's constructor with three arguments: the underlying view and an integer indicating a lower
+     *        offset and another integer indicating the upper offset of the next window.
+     * \tparam urng_t         The type of the input range to process. Must model std::ranges::viewable_range.
+     * \param[in] urange      The input range to process. Must model std::ranges::viewable_range and
+     *                        std::ranges::forward_range.
+     * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+     * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+     * \throws std::invalid_argument if window_min is smaller than 2 or window_max is not greater than window_min.
+     * \returns  A range of the converted values in arrays of size `order`.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, size_t const window_min, size_t const window_max) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::randstrobe cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::forward_range<urng_t>,
+                      "The range parameter to views::randstrobe must model std::ranges::forward_range.");
+
+        if (window_min < 2 || window_max <= window_min)
+            throw std::invalid_argument{"The chosen min and max windows are not valid. "
+                                        "Please choose a window_min greater than 1 and a window_max greater than "
+                                        "window_min."};
+
+        return randstrobe_view<std::views::all_t<urng_t>, order>{std::forward<urng_t>(urange), window_min, window_max};
+    }
+};
+//![adaptor_def]
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief Computes randstrobes for a range of comparable values. A randstrobe consists of a starting strobe
+ * concatenated with n−1 strobes, that are each chosen by a random function depending on the previous strobes.
+ * \tparam order  The number of strobes in one randstrobe, either 2 or 3.
+ * \tparam urng_t The type of the range being processed. See below for requirements. [template
+ *                 parameter is omitted in pipe notation]
+ * \param[in] urange The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] window_min  The lower offset for the position of the next window from the previous one.
+ * \param[in] window_max  The upper offset for the position of the next window from the previous one.
+ * \throws std::invalid_argument if window_min is smaller than 2 or window_max is not greater than window_min.
+ * \returns A range of std::unsigned_integral where each value is an array of size `order`. See below for the
+ *          properties of the returned range.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * A randstrobe defined by [Sahlin K.](https://genome.cshlp.org/content/31/11/2080.full.pdf) consists of
+ * a starting strobe concatenated with n−1 strobes. The i-th strobe is taken from the window with the offsets
+ * `[(i - 2) * window_max + window_min, (i - 1) * window_max]` relative to the first strobe and is the value
+ * minimising `(sum of previous strobes + value) & 0xFFFF`. If several values share the minimum, the leftmost one is
+ * chosen.
+ * For example for the following list of hash values `[60000, 26, 41, 65510, 24, 33, 6, 27, 47]` and 3 as
+ * `window_min`, 5 as `window_max`, the randstrobe values of order 2 are `[(60000,65510),(26,6),(41,6),(65510,27)]`.
+ *
+ * Only the values spanned by one randstrobe are stored in a ring buffer, so the randstrobes are computed lazily
+ * and without allocating memory per randstrobe.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       | *required*                         | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *lost*                           |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | std::unsigned_integral             | std::array                       |
+ *
+ * See the views views submodule documentation for detailed descriptions of the view properties.
+ */
+template <uint8_t order>
+inline constexpr auto randstrobe = detail::randstrobe_fn<order>{};
+
+} // namespace seqan3::views
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
 //
 /*! \brief Function that ensures random hashes, based on https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
  *  \param hash_value The hash_value that should be transformed.
  *  \param seed       The seed.
  */
-uint64_t fnv_hash(uint64_t hash_value, uint64_t seed)
+inline uint64_t fnv_hash(uint64_t hash_value, uint64_t seed)
 {
     // If seed is 0, then the hash value is just returned.
     if (seed == 0)
@@ -27,3 +32,52 @@ uint64_t fnv_hash(uint64_t hash_value, uint64_t seed)
 
     return hashed;
 }
+
+/*! \brief The finaliser of MurmurHash3, every bit of the value affects every bit of the result.
+ *  \param h The value.
+ */
+inline uint64_t murmur_mix(uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/*! \brief The factor the first of two strobes is multiplied with, 4^k modulo 2^64.
+ *  \param kmer_size The size of the shape of a strobe.
+ */
+inline uint64_t strobe_multiplicator(size_t const kmer_size) noexcept
+{
+    return kmer_size < 32 ? uint64_t{1} << (2 * kmer_size) : 0;
+}
+
+/*! \brief Function that combines the hash values of two strobes.
+ *  \param multiplicator The factor the first strobe is multiplied with, usually 4^k.
+ *  \param first_strobe  The hash value of the first strobe.
+ *  \param second_strobe The hash value of the second strobe.
+ */
+inline uint64_t combine_strobes(uint64_t multiplicator, uint64_t first_strobe, uint64_t second_strobe)
+{
+    return first_strobe*multiplicator + second_strobe;
+}
+
+/*! \brief Function that combines the hash values of an arbitrary number of strobes.
+ *  Two strobes are combined by multiplication as above. With more strobes, the first one would be shifted out of the
+ *  64 bits for k > 10, so the combined hash of the previous strobes is mixed before the next strobe is added.
+ *  \param multiplicator The factor the first of two strobes is multiplied with, usually 4^k.
+ *  \param strobes       The hash values of the strobes.
+ */
+template <typename value_t, size_t order>
+inline uint64_t combine_strobes(uint64_t multiplicator, std::array<value_t, order> const & strobes)
+{
+    if constexpr (order == 2)
+        return combine_strobes(multiplicator, strobes[0], strobes[1]);
+
+    uint64_t combined = strobes[0];
+    for (size_t i = 1; i < order; ++i)
+        combined = murmur_mix(combined) ^ strobes[i];
+    return combined;
+}
@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sliding_window_minimum.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief A monotone queue, that keeps track of the minimum of the last `window_size` values pushed into it.
+ * \tparam value_t The type of the values, must be comparable.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * Values are pushed one after another and are implicitly numbered starting from 0. The queue only keeps the values,
+ * that can still become the minimum of the window, in increasing order. Therefore, pushing a value and querying the
+ * minimum take amortized constant time. If several values share the minimum, the leftmost one is reported.
+ *
+ * The queue never holds more than `window_size` values, so it is stored in a ring buffer, whose size is a power of two
+ * and which is allocated once on construction.
+ */
+template <typename value_t>
+class sliding_window_minimum
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sliding_window_minimum() = default; //!< Defaulted.
+    sliding_window_minimum(sliding_window_minimum const &) = default; //!< Defaulted.
+    sliding_window_minimum(sliding_window_minimum &&) = default; //!< Defaulted.
+    sliding_window_minimum & operator=(sliding_window_minimum const &) = default; //!< Defaulted.
+    sliding_window_minimum & operator=(sliding_window_minimum &&) = default; //!< Defaulted.
+    ~sliding_window_minimum() = default; //!< Defaulted.
+
+    /*!\brief Construct an empty queue for the given window size.
+     * \param[in] window_size The number of values the minimum is computed over. Must be greater than 0.
+     */
+    explicit sliding_window_minimum(size_t const window_size) :
+        window_size{window_size},
+        values(std::bit_ceil(window_size)),
+        positions(std::bit_ceil(window_size)),
+        mask{std::bit_ceil(window_size) - 1}
+    {}
+    //!\}
+
+    /*!\brief Appends a value and drops the value, that is no longer part of the window.
+     * \param[in] value The value to append.
+     */
+    void push(value_t const value) noexcept
+    {
+        uint64_t const position = pushed++;
+
+        if (head != tail && positions[head & mask] + window_size <= position)
+            ++head;
+
+        while (head != tail && value < values[(tail - 1) & mask])
+            --tail;
+
+        values[tail & mask] = value;
+        positions[tail & mask] = position;
+        ++tail;
+    }
+
+    //!\brief Returns the minimum of the current window.
+    value_t min_value() const noexcept
+    {
+        return values[head & mask];
+    }
+
+    //!\brief Returns the position of the minimum of the current window, i.e. the number of values pushed before it.
+    uint64_t min_position() const noexcept
+    {
+        return positions[head & mask];
+    }
+
+    //!\brief Removes all values, the next pushed value gets the position 0 again.
+    void clear() noexcept
+    {
+        head = tail = pushed = 0;
+    }
+
+private:
+    //!\brief The number of values the minimum is computed over.
+    size_t window_size{};
+
+    //!\brief The values in the queue in increasing order, starting at head.
+    std::vector<value_t> values{};
+
+    //!\brief The positions belonging to the values.
+    std::vector<uint64_t> positions{};
+
+    //!\brief The mask used to wrap indices of the ring buffer.
+    size_t mask{};
+
+    //!\brief Index of the first element in the queue, not wrapped.
+    size_t head{};
+
+    //!\brief Index behind the last element in the queue, not wrapped.
+    size_t tail{};
+
+    //!\brief The number of values pushed so far.
+    uint64_t pushed{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include "shared.hpp"
+
+/*! \brief Online mean and variance after Welford, including the minimum and the maximum.
+ *  The state has constant size and two accumulators can be merged, e.g. the ones of different threads.
+ */
+class welford_accumulator
+{
+public:
+    /*! \brief Adds a value.
+     *  \param value The value to add.
+     */
+    void push(double const value) noexcept
+    {
+        if (number == 0)
+            minimum = maximum = value;
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+
+        ++number;
+        double const delta = value - mean_value;
+        mean_value += delta / number;
+        squared_distances += delta * (value - mean_value);
+    }
+
+    /*! \brief Adds all values of another accumulator, as if they had been pushed to this one.
+     *  \param other The accumulator to merge.
+     */
+    void merge(welford_accumulator const & other) noexcept
+    {
+        if (other.number == 0)
+            return;
+        if (number == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        uint64_t const combined = number + other.number;
+        double const delta = other.mean_value - mean_value;
+        mean_value += delta * other.number / combined;
+        squared_distances += other.squared_distances + delta * delta * number * other.number / combined;
+        number = combined;
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+    }
+
+    //!\brief The number of values added.
+    uint64_t count() const noexcept
+    {
+        return number;
+    }
+
+    //!\brief The mean of all values, 0 if no value was added.
+    double mean() const noexcept
+    {
+        return mean_value;
+    }
+
+    //!\brief The (population) variance of all values, 0 if no value was added.
+    double variance() const noexcept
+    {
+        return number == 0 ? 0.0 : squared_distances / number;
+    }
+
+    //!\brief The (population) standard deviation of all values, 0 if no value was added.
+    double stdev() const noexcept
+    {
+        return std::sqrt(variance());
+    }
+
+    //!\brief The smallest value, 0 if no value was added.
+    double min() const noexcept
+    {
+        return minimum;
+    }
+
+    //!\brief The largest value, 0 if no value was added.
+    double max() const noexcept
+    {
+        return maximum;
+    }
+
+private:
+    //!\brief The number of values added.
+    uint64_t number{};
+    //!\brief The running mean.
+    double mean_value{};
+    //!\brief The sum of squared distances to the running mean.
+    double squared_distances{};
+    //!\brief The smallest value.
+    double minimum{};
+    //!\brief The largest value.
+    double maximum{};
+};
+
+/*! \brief An exact histogram of non-negative integers, e.g. distances or island lengths.
+ *  Its size only depends on the largest value, not on the number of values.
+ */
+class integer_histogram
+{
+public:
+    /*! \brief Adds a value.
+     *  \param value  The value to add.
+     *  \param weight How often the value is added.
+     */
+    void push(uint64_t const value, uint64_t const weight = 1)
+    {
+        if (value >= bins.size())
+            bins.resize(value + 1, 0);
+        bins[value] += weight;
+        number += weight;
+    }
+
+    /*! \brief Adds all values of another histogram.
+     *  \param other The histogram to merge.
+     */
+    void merge(integer_histogram const & other)
+    {
+        if (other.bins.size() > bins.size())
+            bins.resize(other.bins.size(), 0);
+        for (size_t value = 0; value < other.bins.size(); ++value)
+            bins[value] += other.bins[value];
+        number += other.number;
+    }
+
+    //!\brief The number of values added.
+    uint64_t count() const noexcept
+    {
+        return number;
+    }
+
+    //!\brief How often the given value was added.
+    uint64_t count(uint64_t const value) const noexcept
+    {
+        return value < bins.size() ? bins[value] : 0;
+    }
+
+    //!\brief The smallest value, 0 if no value was added.
+    uint64_t min() const noexcept
+    {
+        auto it = std::find_if(bins.begin(), bins.end(), [] (uint64_t const c) { return c > 0; });
+        return it == bins.end() ? 0 : it - bins.begin();
+    }
+
+    //!\brief The largest value, 0 if no value was added.
+    uint64_t max() const noexcept
+    {
+        return bins.empty() ? 0 : bins.size() - 1;
+    }
+
+    //!\brief The mean of all values, 0 if no value was added.
+    double mean() const noexcept
+    {
+        if (number == 0)
+            return 0.0;
+
+        double sum{};
+        for (size_t value = 0; value < bins.size(); ++value)
+            sum += static_cast<double>(value) * bins[value];
+        return sum / number;
+    }
+
+    //!\brief The (population) variance of all values, 0 if no value was added.
+    double variance() const noexcept
+    {
+        if (number == 0)
+            return 0.0;
+
+        double const mu = mean();
+        double sum{};
+        for (size_t value = 0; value < bins.size(); ++value)
+            sum += (value - mu) * (value - mu) * bins[value];
+        return sum / number;
+    }
+
+    //!\brief The (population) standard deviation of all values, 0 if no value was added.
+    double stdev() const noexcept
+    {
+        return std::sqrt(variance());
+    }
+
+    /*! \brief The smallest value, so that at least the given fraction of all values is smaller or equal.
+     *  \param q The fraction in [0, 1].
+     */
+    uint64_t quantile(double const q) const noexcept
+    {
+        uint64_t const rank = std::max<uint64_t>(1, std::ceil(std::clamp(q, 0.0, 1.0) * number));
+        uint64_t seen{};
+        for (size_t value = 0; value < bins.size(); ++value)
+        {
+            seen += bins[value];
+            if (seen >= rank)
+                return value;
+        }
+        return 0;
+    }
+
+    //!\brief The (lower) median of all values.
+    uint64_t median() const noexcept
+    {
+        return quantile(0.5);
+    }
+
+private:
+    //!\brief The number of occurrences per value.
+    std::vector<uint64_t> bins{};
+    //!\brief The number of values added.
+    uint64_t number{};
+};
+
+/*! \brief A merging t-digest after Dunning and Ertl, that estimates quantiles of a stream of values.
+ *  Values are buffered and merged into at most about `compression` centroids. Centroids at the tails are kept small,
+ *  so extreme quantiles are estimated more precisely than the median. Two digests can be merged.
+ */
+class t_digest
+{
+public:
+    /*! \brief Construct an empty digest.
+     *  \param compression The number of centroids is bounded by roughly this value. Default: 100.
+     */
+    explicit t_digest(double const compression = 100) :
+        compression{compression}
+    {}
+
+    /*! \brief Adds a value.
+     *  \param value  The value to add.
+     *  \param weight The weight of the value.
+     */
+    void push(double const value, double const weight = 1)
+    {
+        if (centroids.empty() && buffer.empty())
+            minimum = maximum = value;
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+
+        buffer.push_back({value, weight});
+        if (buffer.size() >= buffer_size())
+            compress();
+    }
+
+    /*! \brief Adds all values of another digest.
+     *  \param other The digest to merge.
+     */
+    void merge(t_digest const & other)
+    {
+        if (other.centroids.empty() && other.buffer.empty())
+            return;
+        if (centroids.empty() && buffer.empty())
+        {
+            minimum = other.minimum;
+            maximum = other.maximum;
+        }
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+
+        buffer.insert(buffer.end(), other.centroids.begin(), other.centroids.end());
+        buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+        compress();
+    }
+
+    //!\brief The total weight of all values added.
+    double count() const noexcept
+    {
+        double total{};
+        for (auto const & c : centroids)
+            total += c.weight;
+        for (auto const & c : buffer)
+            total += c.weight;
+        return total;
+    }
+
+    /*! \brief Estimates the value, below which the given fraction of all values lies.
+     *  \param q The fraction in [0, 1].
+     *  \returns The estimate, 0 if no value was added.
+     */
+    double quantile(double const q) const
+    {
+        if (!buffer.empty())
+        {
+            t_digest merged{*this};
+            merged.compress();
+            return merged.quantile(q);
+        }
+
+        if (centroids.empty())
+            return 0.0;
+        if (centroids.size() == 1)
+            return centroids[0].mean;
+
+        double const total = count();
+        double const target = std::clamp(q, 0.0, 1.0) * total;
+
+        // The center of a centroid lies at the middle of its weight.
+        double left_center = centroids[0].weight / 2;
+        if (target <= left_center)
+            return interpolate(minimum, centroids[0].mean, target / left_center);
+
+        for (size_t i = 1; i < centroids.size(); ++i)
+        {
+            double const right_center = left_center + (centroids[i - 1].weight + centroids[i].weight) / 2;
+            if (target <= right_center)
+                return interpolate(centroids[i - 1].mean,
+                                   centroids[i].mean,
+                                   (target - left_center) / (right_center - left_center));
+            left_center = right_center;
+        }
+
+        double const rest = total - left_center;
+        return interpolate(centroids.back().mean, maximum, rest == 0 ? 1.0 : (target - left_center) / rest);
+    }
+
+    //!\brief Estimates the median.
+    double median() const
+    {
+        return quantile(0.5);
+    }
+
+private:
+    //!\brief A group of neighbouring values, represented by their mean.
+    struct centroid
+    {
+        //!\brief The mean of the values.
+        double mean;
+        //!\brief The total weight of the values.
+        double weight;
+    };
+
+    //!\brief Bounds the number of centroids.
+    double compression{};
+    //!\brief The centroids sorted by their mean.
+    std::vector<centroid> centroids{};
+    //!\brief Values, that are not merged yet.
+    std::vector<centroid> buffer{};
+    //!\brief The smallest value added.
+    double minimum{};
+    //!\brief The largest value added.
+    double maximum{};
+
+    //!\brief The number of values buffered before they are merged.
+    size_t buffer_size() const noexcept
+    {
+        return 5 * static_cast<size_t>(compression);
+    }
+
+    //!\brief Linear interpolation between a and b.
+    static double interpolate(double const a, double const b, double const fraction) noexcept
+    {
+        return a + (b - a) * std::clamp(fraction, 0.0, 1.0);
+    }
+
+    //!\brief The scale function k_1, mapping a quantile to the index of a centroid.
+    double scale(double const q) const noexcept
+    {
+        return compression / (2 * std::numbers::pi) * std::asin(2 * q - 1);
+    }
+
+    //!\brief The inverse of scale().
+    double inverse_scale(double const k) const noexcept
+    {
+        if (k >= compression / 4)
+            return 1.0;
+        return (std::sin(k * 2 * std::numbers::pi / compression) + 1) / 2;
+    }
+
+    //!\brief Merges the buffer into the centroids.
+    void compress()
+    {
+        if (buffer.empty())
+            return;
+
+        buffer.insert(buffer.end(), centroids.begin(), centroids.end());
+        std::sort(buffer.begin(), buffer.end(), [] (centroid const & a, centroid const & b) { return a.mean < b.mean; });
+
+        double total{};
+        for (auto const & c : buffer)
+            total += c.weight;
+
+        centroids.clear();
+        centroid current = buffer.front();
+        double weight_before{};
+        double limit = inverse_scale(scale(0) + 1) * total;
+
+        for (size_t i = 1; i < buffer.size(); ++i)
+        {
+            if (weight_before + current.weight + buffer[i].weight <= limit)
+            {
+                current.weight += buffer[i].weight;
+                current.mean += (buffer[i].mean - current.mean) * buffer[i].weight / current.weight;
+            }
+            else
+            {
+                weight_before += current.weight;
+                centroids.push_back(current);
+                limit = inverse_scale(scale(weight_before / total) + 1) * total;
+                current = buffer[i];
+            }
+        }
+        centroids.push_back(current);
+        buffer.clear();
+    }
+};
+
+/*! \brief A HyperLogLog sketch after Flajolet et al., that estimates the number of distinct values of a stream.
+ *  It uses 2^precision registers of one byte and has a relative standard error of about 1.04 / sqrt(2^precision).
+ *  Values are mixed before they are added, so structured values like 2-bit encoded k-mers are fine. Two sketches of the
+ *  same precision can be merged.
+ */
+class hyperloglog
+{
+public:
+    /*! \brief Construct an empty sketch.
+     *  \param precision The number of bits, that select a register, in [4, 18]. Default: 14.
+     */
+    explicit hyperloglog(uint8_t const precision = 14) :
+        precision{std::clamp<uint8_t>(precision, 4, 18)},
+        registers(size_t{1} << this->precision, 0)
+    {}
+
+    /*! \brief Adds a value.
+     *  \param value The value to add.
+     */
+    void push(uint64_t const value) noexcept
+    {
+        uint64_t const hash = murmur_mix(value);
+        size_t const index = hash >> (64 - precision);
+        uint64_t const rest = hash << precision;
+        uint8_t const rank = rest == 0 ? 64 - precision + 1 : std::countl_zero(rest) + 1;
+        registers[index] = std::max(registers[index], rank);
+    }
+
+    /*! \brief Adds all values of another sketch.
+     *  \param other The sketch to merge, must have the same precision.
+     */
+    void merge(hyperloglog const & other) noexcept
+    {
+        for (size_t i = 0; i < registers.size() && i < other.registers.size(); ++i)
+            registers[i] = std::max(registers[i], other.registers[i]);
+    }
+
+    //!\brief The estimated number of distinct values added.
+    double estimate() const noexcept
+    {
+        double const m = registers.size();
+        double sum{};
+        size_t zeros{};
+        for (uint8_t const rank : registers)
+        {
+            sum += std::ldexp(1.0, -rank);
+            zeros += rank == 0;
+        }
+
+        double const alpha = 0.7213 / (1 + 1.079 / m);
+        double const raw = alpha * m * m / sum;
+        // Linear counting is more precise for small cardinalities.
+        if (raw <= 2.5 * m && zeros > 0)
+            return m * std::log(m / zeros);
+        return raw;
+    }
+
+private:
+    //!\brief The number of bits, that select a register.
+    uint8_t precision{};
+    //!\brief The largest rank per register.
+    std::vector<uint8_t> registers{};
+};
@@ -14,6 +14,7 @@
 
 #include <seqan3/std/algorithm>
 #include <deque>
+#include <utility>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -36,16 +37,30 @@ namespace seqan3::detail
  *                 result of seqan3::kmer_hash.
  *
  * \tparam opensyncmer If false, syncmers are used but if ture, open-syncmers are used. Default: False.
+ * \tparam measure_distance If true, then not the actual syncmers are returned, but the number of k-mers between
+ *                          consecutive syncmers. Default: False.
+ * \tparam with_position If true, every syncmer is returned together with its position in the second underlying range
+ *                       as `std::pair<value, position>`. Cannot be combined with measure_distance. Default: False.
  * \implements std::ranges::view
  * \ingroup search_views
  *
  * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
 
  */
-template <std::ranges::view urng1_t, std::ranges::view urng2_t, bool opensyncmer = false>
-class syncmer_view : public std::ranges::view_interface<syncmer_view<urng1_t, urng2_t>>
+template <std::ranges::view urng1_t,
+          std::ranges::view urng2_t,
+          bool opensyncmer = false,
+          bool measure_distance = false,
+          bool with_position = false>
+class syncmer_view : public std::ranges::view_interface<syncmer_view<urng1_t,
+                                                                     urng2_t,
+                                                                     opensyncmer,
+                                                                     measure_distance,
+                                                                     with_position>>
 {
 private:
+    static_assert(!(measure_distance && with_position),
+                  "The syncmer_view can either measure distances or return positions, not both.");
     static_assert(std::ranges::forward_range<urng1_t>, "The syncmer_view only works on forward_ranges.");
     static_assert(std::ranges::forward_range<urng2_t>, "The syncmer_view only works on forward_ranges.");
     static_assert(std::totally_ordered<std::ranges::range_reference_t<urng1_t>>,
@@ -187,9 +202,13 @@ public:
 };
 
 //!\brief Iterator for calculating syncmers.
-template <std::ranges::view urng1_t, std::ranges::view urng2_t, bool opensyncmer>
+template <std::ranges::view urng1_t,
+          std::ranges::view urng2_t,
+          bool opensyncmer,
+          bool measure_distance,
+          bool with_position>
 template <bool const_range>
-class syncmer_view<urng1_t, urng2_t, opensyncmer>::basic_iterator
+class syncmer_view<urng1_t, urng2_t, opensyncmer, measure_distance, with_position>::basic_iterator
 {
 private:
     //!\brief The sentinel type of the first underlying range.
@@ -208,8 +227,13 @@ public:
      */
     //!\brief Type for distances between iterators.
     using difference_type = std::ranges::range_difference_t<urng1_t>;
-    //!\brief Value type of this iterator.
-    using value_type = std::ranges::range_value_t<urng2_t>;
+    //!\brief Value type of this iterator, a distance if measure_distance is true and paired with the position if
+    //!       with_position is true.
+    using value_type = std::conditional_t<measure_distance,
+                                          size_t,
+                                          std::conditional_t<with_position,
+                                                             std::pair<std::ranges::range_value_t<urng2_t>, uint64_t>,
+                                                             std::ranges::range_value_t<urng2_t>>>;
     //!\brief The pointer type.
     using pointer = void;
     //!\brief Reference to `value_type`.
@@ -239,7 +263,10 @@ public:
           urng1_iterator{std::move(it.urng1_iterator)},
           urng2_iterator{std::move(it.urng2_iterator)},
           urng1_sentinel{std::move(it.urng1_sentinel)},
-          w_size{std::move(it.w_size)}
+          w_size{std::move(it.w_size)},
+          t_value{it.t_value},
+          position{it.position},
+          distance_begin{it.distance_begin}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -356,7 +383,7 @@ private:
     urng1_sentinel_t urng1_sentinel{};
 
     //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current syncmer.
-    std::deque<value_type> window_values{};
+    std::deque<std::ranges::range_value_t<urng1_t>> window_values{};
 
     //!brief The number of elements in one window.
     size_t w_size{};
@@ -364,6 +391,12 @@ private:
     //!brief The offset for the position of the smallest sub-window.
     size_t t_value{};
 
+    //!brief The position of urng2_iterator in the second range.
+    uint64_t position{};
+
+    //!brief The position following the last syncmer. Only relevant, if measure_distance is true.
+    uint64_t distance_begin{};
+
     //!\brief Increments iterator by 1.
     void next_unique_syncmer()
     {
@@ -375,12 +408,13 @@ private:
     {
         ++urng1_iterator;
         ++urng2_iterator;
+        ++position;
     }
 
     //!\brief Determine the smallest s.
     void determine_smallest_s()
     {
-        auto smallest_s_it = std::ranges::min_element(window_values, std::less<value_type>{});
+        auto smallest_s_it = std::ranges::min_element(window_values, std::less<>{});
         syncmer_position_offset = std::distance(std::begin(window_values), smallest_s_it);
     }
 
@@ -402,11 +436,25 @@ private:
         determine_smallest_s();
 
         if (check_if_syncmer())
-            syncmer_value = *urng2_iterator;
+            set_syncmer_value();
         else
             next_unique_syncmer();
     }
 
+    //!\brief Stores the k-mer of the current window as syncmer.
+    void set_syncmer_value()
+    {
+        if constexpr (measure_distance)
+        {
+            syncmer_value = position - distance_begin;
+            distance_begin = position + 1;
+        }
+        else if constexpr (with_position)
+            syncmer_value = {*urng2_iterator, position};
+        else
+            syncmer_value = *urng2_iterator;
+    }
+
     //!\brief Check if the current value is a syncmer.
     bool check_if_syncmer()
     {
@@ -437,7 +485,7 @@ private:
         if (urng1_iterator == urng1_sentinel)
             return true;
 
-        value_type const new_value = *urng1_iterator;
+        auto const new_value = *urng1_iterator;
 
         window_values.pop_front();
         window_values.push_back(new_value);
@@ -450,7 +498,7 @@ private:
 
         if (check_if_syncmer())
         {
-            syncmer_value = *urng2_iterator;
+            set_syncmer_value();
             return true;
         }
         else
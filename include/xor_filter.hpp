@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+#include "bin_bitvector.hpp"
+#include "shared.hpp"
+
+/*! \brief A static xor filter of a set of values, after Graf and Lemire.
+ *  The filter has about 1.23 slots per value in three segments. A value is hashed to one slot per segment and to a
+ *  fingerprint, the fingerprints in the slots are chosen, so that the three slots of every value xor to its
+ *  fingerprint. A lookup reads three slots, other values match with probability 2^-bits. The slots are packed with the
+ *  given number of bits.
+ */
+class xor_filter
+{
+public:
+    xor_filter() = default;
+
+    /*! \brief Construct the filter.
+     *  \param values The values, which may contain duplicates.
+     *  \param bits   The bits of a fingerprint, between 1 and 32.
+     */
+    xor_filter(std::vector<uint64_t> values, size_t const bits) :
+        bits{std::clamp<size_t>(bits, 1, 32)}
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        count = values.size();
+        if (count == 0)
+            return;
+
+        segment = (static_cast<uint64_t>(std::ceil(1.23 * count)) + 32) / 3;
+        std::vector<uint32_t> slots(3 * segment, 0);
+        std::vector<uint64_t> hashes{};
+        std::vector<uint64_t> assigned{};
+
+        // The construction fails with a small probability, then it is repeated with the next seed.
+        while (!peel(values, hashes, assigned))
+            ++seed;
+
+        // The values are assigned in reverse order of peeling. No value assigned before uses the slot of a value, so it
+        // is still 0 and is set to the xor of the fingerprint and the other two slots, later values only read it.
+        for (size_t i = hashes.size(); i-- > 0;)
+        {
+            uint32_t fingerprint = fingerprint_of(hashes[i]);
+            for (uint64_t const position : positions_of(hashes[i]))
+                fingerprint ^= slots[position];
+            slots[assigned[i]] = fingerprint;
+        }
+
+        words.assign((slots.size() * this->bits + 63) / 64 + 1, 0);
+        for (size_t slot = 0; slot < slots.size(); ++slot)
+        {
+            uint64_t const position = slot * this->bits;
+            words[position / 64] |= static_cast<uint64_t>(slots[slot]) << (position % 64);
+            if (position % 64 + this->bits > 64)
+                words[position / 64 + 1] |= static_cast<uint64_t>(slots[slot]) >> (64 - position % 64);
+        }
+    }
+
+    //!\brief The number of distinct values.
+    size_t size() const noexcept
+    {
+        return count;
+    }
+
+    //!\brief The bits of a fingerprint.
+    size_t fingerprint_bits() const noexcept
+    {
+        return bits;
+    }
+
+    //!\brief The memory of the slots in bytes.
+    uint64_t bytes() const noexcept
+    {
+        return 8 * words.size();
+    }
+
+    //!\brief Prefetches the slots of a value, to look it up later.
+    void prefetch(uint64_t const value) const noexcept
+    {
+        if (count == 0)
+            return;
+        for (uint64_t const position : positions_of(hash_of(value)))
+            __builtin_prefetch(words.data() + position * bits / 64);
+    }
+
+    //!\brief Whether the value may be in the set. A value of the set is always found.
+    bool contains(uint64_t const value) const noexcept
+    {
+        if (count == 0)
+            return false;
+        uint64_t const hash = hash_of(value);
+        uint32_t fingerprint = fingerprint_of(hash);
+        for (uint64_t const position : positions_of(hash))
+            fingerprint ^= slot(position);
+        return fingerprint == 0;
+    }
+
+    //!\brief Serialises the filter with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(bits, count, segment, seed, words);
+    }
+
+private:
+    //!\brief The bits of a fingerprint.
+    uint64_t bits{8};
+    //!\brief The number of distinct values.
+    uint64_t count{};
+    //!\brief The number of slots per segment.
+    uint64_t segment{};
+    //!\brief The seed of the hash function, which succeeded.
+    uint64_t seed{};
+    //!\brief The packed slots.
+    std::vector<uint64_t> words{};
+
+    //!\brief The hash of a value for the current seed.
+    uint64_t hash_of(uint64_t const value) const noexcept
+    {
+        return murmur_mix(value + (seed + 1) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    //!\brief The slot of a hash in every segment, from three different 32 bits of the hash.
+    std::array<uint64_t, 3> positions_of(uint64_t const hash) const noexcept
+    {
+        auto reduce = [this] (uint64_t const part)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(part)) * segment) >> 32;
+        };
+        return {reduce(hash), segment + reduce(std::rotl(hash, 21)), 2 * segment + reduce(std::rotl(hash, 42))};
+    }
+
+    //!\brief The fingerprint of a hash.
+    uint32_t fingerprint_of(uint64_t const hash) const noexcept
+    {
+        return (hash ^ (hash >> 32)) & ((uint64_t{1} << bits) - 1);
+    }
+
+    //!\brief The packed slot at a position.
+    uint32_t slot(uint64_t const slot_index) const noexcept
+    {
+        uint64_t const position = slot_index * bits;
+        uint64_t value = words[position / 64] >> (position % 64);
+        if (position % 64 + bits > 64)
+            value |= words[position / 64 + 1] << (64 - position % 64);
+        return value & ((uint64_t{1} << bits) - 1);
+    }
+
+    /*! \brief Removes values, that are alone in a slot, until no value is left.
+     *  \param values   The distinct values.
+     *  \param hashes   The hashes of the values in the order of removal.
+     *  \param assigned The slot of every removed value, in which it was alone.
+     *  \returns Whether all values were removed.
+     */
+    bool peel(std::vector<uint64_t> const & values, std::vector<uint64_t> & hashes, std::vector<uint64_t> & assigned)
+    {
+        // Every slot has the number of its values and the xor of their hashes, so a slot with one value knows it.
+        std::vector<uint32_t> counts(3 * segment, 0);
+        std::vector<uint64_t> xors(3 * segment, 0);
+        for (uint64_t const value : values)
+        {
+            uint64_t const hash = hash_of(value);
+            for (uint64_t const position : positions_of(hash))
+            {
+                ++counts[position];
+                xors[position] ^= hash;
+            }
+        }
+
+        std::vector<uint64_t> alone{};
+        for (uint64_t position = 0; position < counts.size(); ++position)
+            if (counts[position] == 1)
+                alone.push_back(position);
+
+        hashes.clear();
+        assigned.clear();
+        while (!alone.empty())
+        {
+            uint64_t const position = alone.back();
+            alone.pop_back();
+            if (counts[position] != 1)
+                continue;
+
+            uint64_t const hash = xors[position];
+            hashes.push_back(hash);
+            assigned.push_back(position);
+            for (uint64_t const other : positions_of(hash))
+            {
+                --counts[other];
+                xors[other] ^= hash;
+                if (counts[other] == 1)
+                    alone.push_back(other);
+            }
+        }
+        return hashes.size() == values.size();
+    }
+};
+
+/*! \brief An xor filter per bin, an alternative to an ibf with a fixed number of memory accesses per bin.
+ *  The filters are static, every bin is built once from all its values.
+ */
+class binned_xor_filter
+{
+public:
+    binned_xor_filter() = default;
+
+    /*! \brief Construct empty filters.
+     *  \param bins The number of bins.
+     */
+    explicit binned_xor_filter(size_t const bins) :
+        filters(bins)
+    {}
+
+    /*! \brief Builds the filter of a bin. Different bins can be built by different threads.
+     *  \param bin    The bin.
+     *  \param values The values of the bin.
+     *  \param bits   The bits of a fingerprint, the false positive rate is 2^-bits.
+     */
+    void build(size_t const bin, std::vector<uint64_t> values, size_t const bits)
+    {
+        filters[bin] = xor_filter{std::move(values), bits};
+    }
+
+    //!\brief The number of bins.
+    size_t bin_count() const noexcept
+    {
+        return filters.size();
+    }
+
+    //!\brief The memory of all filters in bytes.
+    uint64_t bytes() const noexcept
+    {
+        uint64_t result{};
+        for (auto const & filter : filters)
+            result += filter.bytes();
+        return result;
+    }
+
+    //!\brief Tests the filters of all bins into its own result, one agent per thread.
+    class membership_agent_type
+    {
+    public:
+        //!\brief Construct an agent for the given filters.
+        explicit membership_agent_type(binned_xor_filter const & filters) :
+            filters{&filters},
+            result{filters.bin_count()}
+        {}
+
+        /*! \brief Determines, which bins contain the value. The slots of all bins are prefetched first.
+         *  \param value The value.
+         *  \returns A reference to the result, which is overwritten by the next query.
+         */
+        bin_bitvector const & bulk_contains(uint64_t const value) noexcept
+        {
+            for (auto const & filter : filters->filters)
+                filter.prefetch(value);
+
+            std::vector<uint64_t> & words = result.raw_data();
+            std::fill(words.begin(), words.end(), 0);
+            for (size_t bin = 0; bin < filters->filters.size(); ++bin)
+                words[bin / 64] |= static_cast<uint64_t>(filters->filters[bin].contains(value)) << (bin % 64);
+            return result;
+        }
+
+    private:
+        //!\brief The filters.
+        binned_xor_filter const * filters{};
+        //!\brief The result of the last query.
+        bin_bitvector result{};
+    };
+
+    //!\brief Returns an agent for queries.
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+
+    //!\brief Serialises the filters with cereal.
+    template <typename archive_t>
+    void serialize(archive_t & archive)
+    {
+        archive(filters);
+    }
+
+private:
+    //!\brief The filter of every bin.
+    std::vector<xor_filter> filters{};
+};
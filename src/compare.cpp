@@ -1,17 +1,45 @@
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <ranges>
+#include <span>
+#include <thread>
 
-#include <index.hpp>
 #include <seqan3/alphabet/adaptation/char.hpp>
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
-#include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/io/views/detail/take_until_view.hpp>
 
+#include "batched_agent.hpp"
+#include "bit_sliced_counter.hpp"
+#include "blocked_ibf.hpp"
 #include "compare.h"
+#include "coverage_bitvector.hpp"
+#include "exact_index.hpp"
+#include "hybridstrobe_hash.hpp"
+#include "hierarchical_ibf.hpp"
+#include "hybridstrobe_hash_distance.hpp"
+#include "ibf_inserter.hpp"
+#include "ibf_sizing.hpp"
+#include "mapped_ibf.hpp"
+#include "occurrence_counter.hpp"
+#include "minstrobe_hash.hpp"
+#include "minstrobe_hash_distance.hpp"
+#include "minstrobe_hash_position.hpp"
 #include "syncmer_hash.hpp"
+#include "syncmer_hash_distance.hpp"
+#include "syncmer_hash_position.hpp"
 #include "minimiser_hash_distance.hpp"
+#include "minimiser_hash_position.hpp"
 #include "modmer_hash.hpp"
 #include "modmer_hash_distance.hpp"
+#include "modmer_hash_position.hpp"
+#include "randstrobe_hash.hpp"
+#include "statistics.hpp"
+#include "xor_filter.hpp"
 
 /*! \brief Calculate mean and variance of given list.
  *  \param results The vector from which mean and varaince should be calculated of.
@@ -30,144 +58,595 @@ void get_mean_and_var(urng_t & results, double & mean, double & stdev)
 }
 
 
-/*! \brief Function, that decides which strobemer to use.
- *  \param seq A std::string sequence.
- *  \param args The range_arguments.
- *  \param strobes_vector The vector for the strobemers.
+/*! \brief Function, searching the sequences of the search file in an ibf with all given thresholds at once.
+ *  \param input_view View that should be tested.
+ *  \param method_name Name of the tested method.
+ *  \param args The arguments about the view to be used.
+ *  \param ibf The index of the bins. It provides bin_count() and membership_agent(), one agent is used per thread and
+ *             its bulk_contains(value).raw_data() are the words of the bins containing the value, bin i is bit i % 64
+ *             of word i / 64. Uncompressed interleaved ibfs are searched with a batched_agent instead, the agent of a
+ *             blocked_ibf also takes a batch of values and the agent of a hierarchical_ibf returns the counts of the
+ *             user bins by bulk_count(hashes, threshold).
  */
-template <int strobemers_func>
-void get_strobemers(std::string & seq, range_arguments const & args,
-std::vector<std::tuple<uint64_t, unsigned int, unsigned int, unsigned int, unsigned int>> & strobes_vector)
+template <typename urng_t, typename ibf_t>
+void search_ibf(urng_t input_view,
+                std::string const & method_name,
+                accuracy_arguments & args,
+                ibf_t const & ibf)
 {
-    if constexpr (strobemers_func == 1)
-        strobes_vector = seq_to_randstrobes2(args.order, args.k_size, args.w_min, args.w_max, seq, 0);
-    else if constexpr (strobemers_func == 2)
-        strobes_vector = seq_to_randstrobes3(args.order, args.k_size, args.w_min, args.w_max, seq, 0);
-    else if constexpr (strobemers_func == 3)
-        strobes_vector = seq_to_hybridstrobes2(args.order, args.k_size, args.w_min, args.w_max, seq, 0);
-    else if constexpr (strobemers_func == 4)
-        strobes_vector = seq_to_minstrobes2(args.order, args.k_size, args.w_min, args.w_max, seq, 0);
+    // Read in "solution", in which files the sequences should be present. The files of a sequence are stored as a
+    // bitset in the layout of the found bins, bin i is bit i % 64 of word i / 64.
+    size_t const bin_words = (ibf.bin_count() + 63) / 64;
+    robin_hood::unordered_node_map<std::string, std::vector<uint64_t>> solutions{};
+    std::ifstream infile;
+    std::string line;
+    infile.open(args.solution_file);
+    std::string name;
+    int exp;
+    while (std::getline(infile, line))
+    {
+        std::istringstream iss(line);
+        iss >> name;
+        std::vector<uint64_t> & truth = solutions[name];
+        truth.assign(bin_words, 0);
+        while (iss >> exp)
+        {
+            if (exp >= 0 && static_cast<size_t>(exp) < ibf.bin_count())
+                truth[exp / 64] |= uint64_t{1} << (exp % 64);
+        }
+    }
+    infile.close();
+
+    std::ofstream outfile;
+    outfile.open(std::string{args.path_out} + method_name + "_" + std::string{args.search_file.stem()} + ".search_out");
+
+    // Every thread reuses its membership agent, its counter and its tp, tn, fp, fn per threshold for all reads.
+    std::vector<float> const & thresholds = args.thresholds;
+    size_t const threads = args.threads;
+    std::vector<decltype(ibf.membership_agent())> agents{};
+    for (size_t thread = 0; thread < threads; ++thread)
+        agents.push_back(ibf.membership_agent());
+    // Uncompressed interleaved ibfs are searched with agents, that look up a batch of hashes at once.
+    constexpr bool interleaved = std::constructible_from<batched_agent, ibf_t const &>;
+    std::vector<batched_agent> batched_agents{};
+    if constexpr (interleaved)
+        for (size_t thread = 0; thread < threads; ++thread)
+            batched_agents.emplace_back(ibf);
+    std::vector<bit_sliced_counter> counters(threads, bit_sliced_counter{ibf.bin_count()});
+    std::vector<std::vector<uint64_t>> found_bins(threads);
+    std::vector<std::vector<uint64_t>> undecided_bins(threads);
+    std::vector<std::vector<uint64_t>> undecided_per_threshold(threads);
+    std::vector<std::vector<uint64_t>> read_hashes(threads);
+    std::vector<occurrence_counter> read_occurrences(threads);
+    // tp, tn, fp, fn, with 1024 bins tn exceeds 2^31 after about 2 million reads.
+    std::vector<std::array<uint64_t, 4>> const no_results(thresholds.size(), std::array<uint64_t, 4>{});
+    std::vector<std::vector<std::array<uint64_t, 4>>> thread_results(threads, no_results);
+    std::vector<uint64_t> const no_solution(bin_words, 0);
+
+    // Searches one read and returns its line for the .search_out file.
+    auto search_read = [&] (size_t const thread, std::string const & id, seqan3::dna4_vector const & seq)
+    {
+        auto & agent = agents[thread];
+        bit_sliced_counter & counter = counters[thread];
+        std::vector<uint64_t> & found_bin = found_bins[thread];
+        std::vector<uint64_t> & undecided = undecided_bins[thread];
+        std::vector<uint64_t> & undecided_threshold = undecided_per_threshold[thread];
+        std::vector<uint64_t> & hashes = read_hashes[thread];
+        counter.clear();
+        hashes.clear();
+        for (auto && hash : seq | input_view)
+            hashes.push_back(hash);
+        uint64_t const length = hashes.size();
+        // A count is an integer, so it reaches length * threshold, if it reaches the rounded up value.
+        std::vector<uint64_t> read_thresholds(thresholds.size());
+        for (size_t t = 0; t < thresholds.size(); ++t)
+            read_thresholds[t] = std::ceil(length * thresholds[t]);
+
+        // The hierarchical ibf counts its user bins itself, its lower ibfs are searched for the smallest threshold.
+        std::vector<uint64_t> const * user_counts{nullptr};
+        if constexpr (std::same_as<ibf_t, hierarchical_ibf>)
+        {
+            uint64_t const smallest = read_thresholds.empty() ? 0 : *std::min_element(read_thresholds.begin(),
+                                                                                       read_thresholds.end());
+            user_counts = &agent.bulk_count(hashes, smallest);
+        }
+        else
+        {
+            // With deduplication, every distinct hash is looked up once and its hits are added once per occurrence,
+            // so the counts are the same as without.
+            std::span<uint64_t const> lookups{hashes};
+            uint64_t const * occurrences{nullptr};
+            if (args.dedup)
+            {
+                read_occurrences[thread].count(hashes);
+                lookups = read_occurrences[thread].values();
+                occurrences = read_occurrences[thread].counts().data();
+            }
+
+            // A bin is decided, once its count reached a threshold or cannot reach it with the remaining hashes, for
+            // all thresholds. Decided bins are not counted anymore and the search stops, when all bins are decided.
+            // The decided bins are updated every 16 lookups, bins decided in between are still counted, which does not
+            // change the result. The 16 hashes in between are looked up as one batch, where the ibf supports it, so
+            // their cache misses overlap.
+            uint64_t remaining = length;
+            for (size_t i = 0; i < lookups.size(); i += 16)
+            {
+                bool any_undecided{false};
+                for (size_t t = 0; t < read_thresholds.size(); ++t)
+                {
+                    std::vector<uint64_t> & result = t == 0 ? undecided : undecided_threshold;
+                    if (!counter.undecided(read_thresholds[t], remaining, result))
+                        continue;
+                    any_undecided = true;
+                    if (t > 0)
+                        std::transform(undecided.begin(), undecided.end(), undecided_threshold.begin(),
+                                       undecided.begin(), std::bit_or<uint64_t>());
+                }
+                if (!any_undecided)
+                    break;
+
+                // Adds the hits of 64 bins at once, for every occurrence of the j-th hash of the batch.
+                auto const batch = lookups.subspan(i, std::min<size_t>(16, lookups.size() - i));
+                auto add = [&] (uint64_t const * const hits, size_t const j)
+                {
+                    uint64_t const times = occurrences == nullptr ? 1 : occurrences[i + j];
+                    for (uint64_t time = 0; time < times; ++time)
+                        counter.add(hits, undecided.data());
+                    remaining -= times;
+                };
+                if constexpr (interleaved)
+                {
+                    std::vector<uint64_t> const & hits = batched_agents[thread].bulk_contains(batch);
+                    for (size_t j = 0; j < batch.size(); ++j)
+                        add(hits.data() + j * bin_words, j);
+                }
+                else if constexpr (std::same_as<ibf_t, blocked_ibf>)
+                {
+                    std::vector<uint64_t> const & hits = agent.bulk_contains(batch);
+                    for (size_t j = 0; j < batch.size(); ++j)
+                        add(hits.data() + j * bin_words, j);
+                }
+                else
+                {
+                    for (size_t j = 0; j < batch.size(); ++j)
+                        add(agent.bulk_contains(batch[j]).raw_data().data(), j);
+                }
+            }
+        }
+
+        auto solution = solutions.find(id);
+        std::vector<uint64_t> const & expected = (solution == solutions.end()) ? no_solution : solution->second;
+
+        // The .search_out file lists the bins found with the first threshold.
+        std::string line = id + "\t";
+        for (size_t t = 0; t < read_thresholds.size(); ++t)
+        {
+            std::array<uint64_t, 4> & results = thread_results[thread][t];
+            if (user_counts == nullptr)
+            {
+                counter.greater_equal(read_thresholds[t], found_bin);
+            }
+            else
+            {
+                found_bin.assign(bin_words, 0);
+                for (size_t j = 0; j < user_counts->size(); ++j)
+                    found_bin[j / 64] |= uint64_t{(*user_counts)[j] >= read_thresholds[t]} << (j % 64);
+            }
+            uint64_t found{};
+            uint64_t true_positives{};
+            uint64_t positives{};
+            for (size_t w = 0; w < bin_words; ++w)
+            {
+                found += std::popcount(found_bin[w]);
+                true_positives += std::popcount(found_bin[w] & expected[w]);
+                positives += std::popcount(expected[w]);
+
+                if (t == 0)
+                {
+                    for (uint64_t bits = found_bin[w]; bits != 0; bits &= bits - 1)
+                        line += std::to_string(w * 64 + std::countr_zero(bits)) + ",";
+                }
+            }
+
+            results[0] += true_positives;
+            results[1] += ibf.bin_count() - (found + positives - true_positives);
+            results[2] += found - true_positives;
+            results[3] += positives - true_positives;
+        }
+        line += "\n";
+        return line;
+    };
+
+    // Go over the sequences in the search file in batches of bounded size. While the threads search one batch, the
+    // next one is read. The threads pull one read after another, the lines of a batch are written in the order of the
+    // reads.
+    size_t const batch_size = threads * 1024;
+    seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::id, seqan3::field::seq>> fin{args.search_file};
+    auto record = fin.begin();
+    std::vector<std::string> ids{};
+    std::vector<seqan3::dna4_vector> seqs{};
+    std::vector<std::string> next_ids{};
+    std::vector<seqan3::dna4_vector> next_seqs{};
+    std::vector<std::string> lines{};
+
+    auto read_batch = [&] (std::vector<std::string> & batch_ids, std::vector<seqan3::dna4_vector> & batch_seqs)
+    {
+        batch_ids.clear();
+        batch_seqs.clear();
+        for (; record != fin.end() && batch_ids.size() < batch_size; ++record)
+        {
+            auto & [id, seq] = *record;
+            batch_ids.push_back(std::move(id));
+            batch_seqs.push_back(std::move(seq));
+        }
+    };
+
+    auto const start = std::chrono::steady_clock::now();
+    size_t searched{};
+    read_batch(ids, seqs);
+    while (!ids.empty())
+    {
+        lines.assign(ids.size(), std::string{});
+
+        std::atomic<size_t> next_read{0};
+        auto worker = [&] (size_t const thread)
+        {
+            for (size_t i = next_read++; i < ids.size(); i = next_read++)
+                lines[i] = search_read(thread, ids[i], seqs[i]);
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t thread = 0; thread < threads; ++thread)
+            workers.emplace_back(worker, thread);
+        read_batch(next_ids, next_seqs);
+        for (auto & w : workers)
+            w.join();
+
+        for (auto const & line : lines)
+            outfile << line;
+        searched += ids.size();
+
+        std::swap(ids, next_ids);
+        std::swap(seqs, next_seqs);
+    }
+    outfile.close();
+    double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Store tp, tn, fp, fn, one line per threshold. With several thresholds, the threshold follows the method name.
+    // The performance file has the reads per second and the false positive rate, fp / (fp + tn), in the same lines,
+    // so that different ibfs can be compared on the same input.
+    std::ofstream outfile2;
+    outfile2.open(std::string{args.path_out} + method_name +  "_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::ofstream outfile3;
+    outfile3.open(std::string{args.path_out} + method_name +  "_" + std::string{args.search_file.stem()} + "_performance.out");
+    for (size_t t = 0; t < thresholds.size(); ++t)
+    {
+        uint64_t tp = 0, tn = 0, fp = 0, fn = 0;
+        for (auto const & results : thread_results)
+        {
+            tp += results[t][0];
+            tn += results[t][1];
+            fp += results[t][2];
+            fn += results[t][3];
+        }
+        outfile2 << method_name;
+        if (thresholds.size() > 1)
+            outfile2 << "\t" << thresholds[t];
+        outfile2 << "\t" << tp << "\t" << tn << "\t" << fp << "\t" << fn << "\n";
+        outfile3 << method_name;
+        if (thresholds.size() > 1)
+            outfile3 << "\t" << thresholds[t];
+        outfile3 << "\t" << searched / std::max(seconds, 1e-9) << "\t" << fp / std::max(1.0, static_cast<double>(fp + tn))
+                 << "\n";
+    }
+    outfile2.close();
+    outfile3.close();
 }
 
+
 template <typename urng_t>
 void accuracy(urng_t input_view,
               std::string method_name,
               accuracy_arguments & args)
 {
-    // Loading/Creating the ibf.
+    // Loading/Creating the ibf. A created ibf is searched right away and stored in the background, if requested.
     seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed> ibf;
-    if ((std::filesystem::path{args.input_file[0]}.extension() == ".ibf") & (args.input_file.size() == 1))
+    std::future<void> stored{};
+    std::filesystem::path const first_extension = std::filesystem::path{args.input_file[0]}.extension();
+    bool const index_file = (first_extension == ".ibf") | (first_extension == ".hibf") |
+                            (first_extension == ".bibf") | (first_extension == ".exact") |
+                            (first_extension == ".xor");
+    bool const created = !(index_file & (args.input_file.size() == 1));
+
+    // A hierarchical or blocked ibf, an exact index and xor filters are loaded with cereal.
+    if (!created && first_extension == ".hibf")
     {
-        load_ibf(ibf, args.input_file[0]);
+        hierarchical_ibf hibf{};
+        load_ibf(hibf, args.input_file[0]);
+        search_ibf(input_view, method_name, args, hibf);
+        return;
+    }
+    if (!created && first_extension == ".bibf")
+    {
+        blocked_ibf bibf{};
+        load_ibf(bibf, args.input_file[0]);
+        search_ibf(input_view, method_name, args, bibf);
+        return;
+    }
+    if (!created && first_extension == ".exact")
+    {
+        exact_index index{};
+        load_ibf(index, args.input_file[0]);
+        search_ibf(input_view, method_name, args, index);
+        return;
     }
-    else if (std::filesystem::path{args.input_file[0]}.extension() == ".out")
+    if (!created && first_extension == ".xor")
     {
-        seqan3::interleaved_bloom_filter ibf_create{seqan3::bin_count{args.input_file.size()},
-                                     seqan3::bin_size{args.ibfsize},
-                                     seqan3::hash_function_count{args.number_hashes}};
+        binned_xor_filter filters{};
+        load_ibf(filters, args.input_file[0]);
+        search_ibf(input_view, method_name, args, filters);
+        return;
+    }
 
-        uint64_t minimiser;
-        uint16_t minimiser_count;
-        for(size_t i = 0; i < args.input_file.size(); i++)
+    // An ibf in the format of mapped_ibf is searched, where it is mapped, without loading it.
+    if (!created && !args.compressed && is_mapped_ibf(args.input_file[0]))
+    {
+        search_ibf(input_view, method_name, args, mapped_ibf{args.input_file[0]});
+        return;
+    }
+
+    // Calls emplace for every value of the input file i. A record of a .out file is a minimiser and its count, the
+    // records are read in batches.
+    constexpr size_t record_size = sizeof(uint64_t) + sizeof(uint16_t);
+    auto read_file = [&] (size_t const i, auto && emplace)
+    {
+        if (args.input_file[i].extension() == ".out")
         {
+            std::vector<char> buffer(record_size * 4096);
             std::ifstream infile{args.input_file[i], std::ios::binary};
-            while(infile.read((char*)&minimiser, sizeof(minimiser)))
+            uint64_t minimiser;
+            while (infile.read(buffer.data(), buffer.size()) || infile.gcount() > 0)
             {
-                infile.read((char*)&minimiser_count, sizeof(minimiser_count));
-                ibf_create.emplace(minimiser, seqan3::bin_index{i});
+                size_t const bytes = infile.gcount();
+                for (size_t offset = 0; offset + sizeof(minimiser) <= bytes; offset += record_size)
+                {
+                    std::memcpy(&minimiser, buffer.data() + offset, sizeof(minimiser));
+                    emplace(minimiser);
+                }
             }
         }
-        store_ibf(ibf_create, std::string{args.path_out} + method_name + ".ibf");
-        load_ibf(ibf, std::string{args.path_out} + method_name + ".ibf");
+        else // Sequence files
+        {
+            for (auto && [seq] : seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>>{args.input_file[i]})
+                for (auto && value : seq | input_view)
+                    emplace(value);
+        }
+    };
+
+    // The exact index needs the values of all files at once, the threads read one file after another.
+    if (created && args.exact)
+    {
+        std::vector<std::vector<uint64_t>> values(args.input_file.size());
+        std::atomic<size_t> next_file{0};
+        auto worker = [&] ()
+        {
+            for (size_t i = next_file++; i < args.input_file.size(); i = next_file++)
+                read_file(i, [&values, i] (uint64_t const value) { values[i].push_back(value); });
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t thread = 1; thread < std::min<size_t>(args.threads, args.input_file.size()); ++thread)
+            workers.emplace_back(worker);
+        worker();
+        for (auto & w : workers)
+            w.join();
+
+        exact_index index{values};
+        values = {};
+        std::cout << "Exact index: " << index.size() << " distinct values, memory: "
+                  << index.bytes() / (1024.0 * 1024.0) << " MiB.\n";
+        if (!args.no_store)
+        {
+            stored = std::async(std::launch::async, [&index, opath = std::string{args.path_out} + method_name + ".exact"] ()
+            {
+                store_ibf(index, opath);
+            });
+        }
+        search_ibf(input_view, method_name, args, index);
+        if (stored.valid())
+            stored.get();
+        return;
     }
-    else // Sequence files
+
+    // The xor filters are built per bin from all its values, a thread reads a file and builds its filter. The bits of
+    // a fingerprint are chosen for the false positive rate, as for the ibf.
+    if (created && args.xor_filters)
     {
-        seqan3::interleaved_bloom_filter ibf_create{seqan3::bin_count{args.input_file.size()},
-                                     seqan3::bin_size{args.ibfsize},
-                                     seqan3::hash_function_count{args.number_hashes}};
+        size_t const bits = std::clamp<size_t>(std::ceil(-std::log2(args.fpr)), 1, 32);
+        binned_xor_filter filters{args.input_file.size()};
+        std::atomic<size_t> next_file{0};
+        auto worker = [&] ()
+        {
+            std::vector<uint64_t> values{};
+            for (size_t i = next_file++; i < args.input_file.size(); i = next_file++)
+            {
+                values.clear();
+                read_file(i, [&values] (uint64_t const value) { values.push_back(value); });
+                filters.build(i, values, bits);
+            }
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t thread = 1; thread < std::min<size_t>(args.threads, args.input_file.size()); ++thread)
+            workers.emplace_back(worker);
+        worker();
+        for (auto & w : workers)
+            w.join();
 
-        for(size_t i = 0; i < args.input_file.size(); i++)
+        std::cout << "Xor filters: " << bits << " bits per fingerprint, expected false positive rate: "
+                  << std::ldexp(1.0, -static_cast<int>(bits)) << ", memory: " << filters.bytes() / (1024.0 * 1024.0)
+                  << " MiB.\n";
+        if (!args.no_store)
         {
-            for (auto && [seq] : seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>>{args.input_file[i]})
-                for (auto && value : seq | input_view)
-                    ibf_create.emplace(value, seqan3::bin_index{i});
+            stored = std::async(std::launch::async, [&filters, opath = std::string{args.path_out} + method_name + ".xor"] ()
+            {
+                store_ibf(filters, opath);
+            });
         }
-        store_ibf(ibf_create, std::string{args.path_out} + method_name + ".ibf");
-        load_ibf(ibf, std::string{args.path_out} + method_name + ".ibf");
+        search_ibf(input_view, method_name, args, filters);
+        if (stored.valid())
+            stored.get();
+        return;
     }
 
-    // Search through the ibf with a given threshold.
+    // Without a given ibf size, the bin size and the number of hash functions are derived from the largest number of
+    // distinct values of a bin and the false positive rate. The hierarchical ibf needs the number of every bin. A .out
+    // file has one record per distinct value, the distinct values of a sequence file are estimated.
+    ibf_size size{args.ibfsize, args.number_hashes};
+    std::vector<uint64_t> elements(args.input_file.size(), 0);
+    if (created && (args.ibfsize == 0 || args.hierarchical))
+    {
+        std::atomic<size_t> next_file{0};
+        auto worker = [&] ()
+        {
+            for (size_t i = next_file++; i < args.input_file.size(); i = next_file++)
+            {
+                if (args.input_file[i].extension() == ".out")
+                {
+                    elements[i] = std::filesystem::file_size(args.input_file[i]) / record_size;
+                    continue;
+                }
 
-    // Load search sequence file.
-    seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::id, seqan3::field::seq>> fin{args.search_file};
-    std::vector<std::string> ids;
-    std::vector<seqan3::dna4_vector> seqs;
-    for (auto & [id, seq] : fin)
+                hyperloglog sketch{};
+                read_file(i, [&sketch] (uint64_t const value) { sketch.push(value); });
+                elements[i] = std::ceil(sketch.estimate());
+            }
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t thread = 1; thread < std::min<size_t>(args.threads, args.input_file.size()); ++thread)
+            workers.emplace_back(worker);
+        worker();
+        for (auto & w : workers)
+            w.join();
+    }
+
+    if (created && args.hierarchical)
     {
-        ids.push_back(id);
-        seqs.push_back(seq);
+        hierarchical_ibf hibf{elements, args.fpr};
+        std::cout << "Hierarchical ibf: " << hibf.technical_bin_count() << " technical bins on the top level, "
+                  << hibf.lower_count() << " lower ibfs, expected memory: " << hibf.bytes() / (1024.0 * 1024.0)
+                  << " MiB.\n";
+        // The user bins share the words of the top level in no fixed pattern, so the files are inserted one by one.
+        for (size_t i = 0; i < args.input_file.size(); ++i)
+            read_file(i, [&hibf, i] (uint64_t const value) { hibf.emplace(value, i); });
+
+        if (!args.no_store)
+        {
+            stored = std::async(std::launch::async, [&hibf, opath = std::string{args.path_out} + method_name + ".hibf"] ()
+            {
+                store_ibf(hibf, opath);
+            });
+        }
+        search_ibf(input_view, method_name, args, hibf);
+        if (stored.valid())
+            stored.get();
+        return;
     }
 
-    // Read in "solution", in which files the sequences should be present.
-    robin_hood::unordered_node_map<std::string, std::vector<uint32_t>> solutions{};
-    std::ifstream infile;
-    std::string line;
-    infile.open(args.solution_file);
-    std::string name;
-    int exp;
-    while (std::getline(infile, line))
+    if (created && args.ibfsize == 0)
     {
-        std::istringstream iss(line);
-        iss >> name;
-        solutions[name] = {};
-        while (iss >> exp)
-            solutions[name].push_back(exp);
+        uint64_t const largest = *std::max_element(elements.begin(), elements.end());
+        size = args.blocked ? optimal_blocked_size(largest, args.fpr) : optimal_ibf_size(largest, args.fpr);
+        double const fpr = args.blocked ? blocked_false_positive_rate(size.bin_size, size.hash_count, largest)
+                                        : false_positive_rate(size.bin_size, size.hash_count, largest);
+        std::cout << "Largest bin: " << largest << " distinct values. Bin size: " << size.bin_size
+                  << " bits, hash functions: " << size.hash_count << ", expected false positive rate: "
+                  << fpr << ", expected memory: "
+                  << size.bytes(args.input_file.size()) / (1024.0 * 1024.0) << " MiB.\n";
     }
-    infile.close();
 
-    int tp = 0, tn = 0, fp = 0, fn = 0;
-    std::ofstream outfile;
-    outfile.open(std::string{args.path_out} + method_name + "_" + std::string{args.search_file.stem()} + ".search_out");
-    // Go over the sequences in the search file.
-    for (int i = 0; i < seqs.size(); ++i)
-    {
-        std::vector<uint32_t> counter;
-        counter.assign(ibf.bin_count(), 0);
-        uint64_t length = 0;
-        auto agent = ibf.membership_agent();
-        for (auto && hash : seqs[i] | input_view)
+    // The threads pull one file after another. The inserter, an ibf_inserter or the blocked ibf, sets the bits with
+    // atomic or, so the files of bins sharing a word can be inserted by different threads.
+    auto insert_files = [&] (auto && inserter)
+    {
+        std::atomic<size_t> next_file{0};
+        auto worker = [&] ()
         {
-            std::transform (counter.begin(), counter.end(), agent.bulk_contains(hash).begin(), counter.begin(),
-                            std::plus<int>());
-            ++length;
-        }
+            for (size_t i = next_file++; i < args.input_file.size(); i = next_file++)
+                read_file(i, [&inserter, i] (uint64_t const value) { inserter.emplace(value, seqan3::bin_index{i}); });
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t thread = 1; thread < std::min<size_t>(args.threads, args.input_file.size()); ++thread)
+            workers.emplace_back(worker);
+        worker();
+        for (auto & w : workers)
+            w.join();
+    };
 
-        outfile << ids[i] << "\t";
-        for (int j = 0; j < ibf.bin_count(); ++j)
+    if (created && args.blocked)
+    {
+        blocked_ibf bibf{seqan3::bin_count{args.input_file.size()},
+                         seqan3::bin_size{size.bin_size},
+                         seqan3::hash_function_count{size.hash_count}};
+        insert_files(bibf);
+        if (!args.no_store)
         {
-            bool found = (counter[j] >= (length * args.threshold));
-            bool true_positive = std::binary_search(solutions[ids[i]].begin(), solutions[ids[i]].end(), j);
-            if (counter[j] >= (length * args.threshold))
-                outfile << j << ",";
-
-            if (found && true_positive)
-                tp++;
-            else if(found && !true_positive)
-                fp++;
-            else if (!found &&true_positive)
-                fn++;
-            else if (!found && !true_positive)
-                tn++;
+            stored = std::async(std::launch::async, [&bibf, opath = std::string{args.path_out} + method_name + ".bibf"] ()
+            {
+                store_ibf(bibf, opath);
+            });
         }
-        outfile << "\n";
+        search_ibf(input_view, method_name, args, bibf);
+        if (stored.valid())
+            stored.get();
+        return;
     }
-    outfile.close();
 
-    // Store tp, tn, fp, fn
-    std::ofstream outfile2;
-    outfile2.open(std::string{args.path_out} + method_name +  "_" + std::string{args.search_file.stem()} + "_accuracy.out");
-    outfile2 << method_name << "\t" << tp << "\t" << tn << "\t" << fp << "\t" << fn << "\n";
-    outfile2.close();
+    if (!created)
+    {
+        load_ibf(ibf, args.input_file[0]);
+    }
+    else
+    {
+        ibf = seqan3::interleaved_bloom_filter{seqan3::bin_count{args.input_file.size()},
+                                               seqan3::bin_size{size.bin_size},
+                                               seqan3::hash_function_count{size.hash_count}};
+        insert_files(ibf_inserter{ibf});
+    }
+
+    // A created ibf is stored in the format of mapped_ibf, together with the parameters of the method.
+    if (created && !args.no_store)
+    {
+        mapped_ibf_header header{};
+        header.k_size = args.k_size;
+        header.w_size = args.w_size.get();
+        header.shape = args.shape.to_ulong();
+        header.seed = args.seed_se.get();
+        std::copy_n(method_name.begin(), std::min(method_name.size(), header.method.size() - 1), header.method.begin());
+        stored = std::async(std::launch::async, [&ibf, header, opath = std::string{args.path_out} + method_name + ".ibf"] ()
+        {
+            store_mapped_ibf(ibf, opath, header);
+        });
+    }
+
+    // Search through the ibf with all given thresholds at once. The compressed ibf is built while the uncompressed
+    // one is stored, the uncompressed one is freed before the search.
+    if (args.compressed)
+    {
+        seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> compressed_ibf{ibf};
+        if (stored.valid())
+            stored.get();
+        ibf = seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>{};
+        search_ibf(input_view, method_name, args, compressed_ibf);
+        return;
+    }
+    search_ibf(input_view, method_name, args, ibf);
+
+    // The ibf must outlive its storing.
+    if (stored.valid())
+        stored.get();
 }
 
 /*! \brief Function, counting the number of submers.
@@ -176,7 +655,7 @@ void accuracy(urng_t input_view,
  *  \param method_name Name of the tested method.
  *  \param args The arguments about the view to be used, needed for strobemers.
  */
-template <typename urng_t, int strobemers = 0>
+template <typename urng_t>
 void counts(std::vector<std::filesystem::path> sequence_files, urng_t input_view, std::string method_name, range_arguments & args)
 {
     std::vector<int> counts_results{};
@@ -184,25 +663,11 @@ void counts(std::vector<std::filesystem::path> sequence_files, urng_t input_view
     for (int i = 0; i < sequence_files.size(); ++i)
     {
         robin_hood::unordered_node_map<uint64_t, uint16_t> hash_table{};
-        if constexpr (strobemers > 0)
+        seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
+        for (auto & [seq] : fin)
         {
-            seqan3::sequence_file_input<my_traits2, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
-            for (auto & [seq] : fin)
-            {
-                std::vector<std::tuple<uint64_t, unsigned int, unsigned int, unsigned int, unsigned int>> strobes_vector;
-                get_strobemers<strobemers>(seq, args, strobes_vector);
-                for (auto & t : strobes_vector) // iterate over the strobemer tuples
-                    hash_table[std::get<0>(t)] = std::min<uint16_t>(65534u, hash_table[std::get<0>(t)] + 1);
-            }
-        }
-        else
-        {
-            seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
-            for (auto & [seq] : fin)
-            {
-                for (auto && hash : seq | input_view)
-                    hash_table[hash] = std::min<uint16_t>(65534u, hash_table[hash] + 1);
-            }
+            for (auto && hash : seq | input_view)
+                hash_table[hash] = std::min<uint16_t>(65534u, hash_table[hash] + 1);
         }
         counts_results.push_back(hash_table.size());
 
@@ -225,171 +690,229 @@ void counts(std::vector<std::filesystem::path> sequence_files, urng_t input_view
     outfile.close();
 }
 
-/*! \brief Function, that increases how often a position is covered by one.
- *  \param covs A vector, where every entry represents a position in the sequence and how often it is covered.
- *  \param position Starting position.
- *  \param shape The positions of covered positions.
- */
-void positions_covered(std::vector<uint32_t> & covs, int position, seqan3::shape shape)
+//!\brief The statistics of distances. The states of different threads or files are merged.
+struct distance_statistics
 {
-    for(int pos = 0; pos < shape.size(); pos++)
+    //!\brief Mean and variance.
+    welford_accumulator moments{};
+    //!\brief The exact number of every distance.
+    integer_histogram histogram{};
+    //!\brief Estimates the percentiles.
+    t_digest digest{};
+
+    //!\brief Adds a distance.
+    void push(uint64_t const distance)
     {
-        if (shape[pos] == 1)
-            covs[position+pos]++;
+        moments.push(distance);
+        histogram.push(distance);
+        digest.push(distance);
     }
-}
 
-/*! \brief Function, get the actual coverage of some submers.
- *  \param kmers A view that contains all possible k-mers (minimisers with window length = kmer length, if reverse strand should be considered).
- *  \param submers The submers, which coverage should be obtained.
- *  \param covs A vector, where every entry represents a position in the sequence and how often it is covered.
- *  \param shape Shape of a submer.
+    //!\brief Adds all distances of other statistics.
+    void merge(distance_statistics const & other)
+    {
+        moments.merge(other.moments);
+        histogram.merge(other.histogram);
+        digest.merge(other.digest);
+    }
+
+    /*! \brief Writes min, mean, standard deviation, max, the exact median and the 5th, 25th, 75th and 95th percentile
+     *  estimated by the t-digest.
+     */
+    void write(std::ostream & out, std::string const & method_name) const
+    {
+        out << method_name << "\t" << moments.min() << "\t" << moments.mean() << "\t" << moments.stdev() << "\t"
+            << moments.max() << "\t" << histogram.median();
+        for (double const q : {0.05, 0.25, 0.75, 0.95})
+            out << "\t" << digest.quantile(q);
+        out << "\n";
+    }
+};
+
+/*! \brief The statistics of the coverage and the islands of records. The states of different threads or files are
+ *  merged.
  */
-template <typename urng_t>
-void coverage(urng_t kmers, std::deque<uint64_t> & submers, std::vector<uint32_t> & covs, seqan3::shape shape)
+struct island_statistics
 {
-    int i{};
-    for (auto && elem : kmers)
+    //!\brief The covered positions.
+    welford_accumulator covered{};
+    //!\brief Estimates the median of the average coverage.
+    t_digest coverage{};
+    //!\brief The largest island.
+    welford_accumulator largest_islands{};
+    //!\brief The average island, records without islands count with 0.
+    welford_accumulator average_islands{};
+
+    /*! \brief Adds a record.
+     *  \param covs      The covered positions of the record.
+     *  \param submers   The number of submers of the record.
+     *  \param positions The number of positions a submer covers.
+     *  \param length    The length of the record.
+     */
+    void push(coverage_bitvector const & covs, uint64_t const submers, uint64_t const positions, uint64_t const length)
     {
-        if (elem == submers[0])
+        integer_histogram islands{};
+        covs.for_each_island([&] (uint64_t const, uint64_t const island)
         {
-            positions_covered(covs, i, shape);
-            submers.pop_front();
-        }
+            islands.push(island);
+        });
 
-        if (submers.size() == 0)
-            break;
-        i++;
+        covered.push(covs.count());
+        coverage.push(static_cast<double>(submers) * positions / length);
+        average_islands.push(islands.mean());
+        largest_islands.push(islands.max());
+    }
+
+    //!\brief Adds all records of other statistics.
+    void merge(island_statistics const & other)
+    {
+        covered.merge(other.covered);
+        coverage.merge(other.coverage);
+        largest_islands.merge(other.largest_islands);
+        average_islands.merge(other.average_islands);
     }
-}
 
-/*! \brief Function, get the coverage of one sequence file for a method.
- *  Strobemers not supported, because strobemers should cover every position at least once because they are not
- *  a sampling method.
+    //!\brief Writes one line each for the covered positions, the average coverage, the largest and the average island.
+    void write(std::ostream & out, std::string const & method_name) const
+    {
+        out << "Covered\t"<< method_name << "\t" << covered.min() << "\t" << covered.mean() << "\t" << covered.stdev() << "\t" << covered.max() << "\n";
+        out << "Covered Median\t"<< method_name << "\t" << coverage.quantile(0) << "\t" << coverage.median() << "\t" << coverage.quantile(1) << "\n";
+        out << "Largest Island\t"<< method_name << "\t" << largest_islands.min() << "\t" << largest_islands.mean() << "\t" << largest_islands.stdev() << "\t" << largest_islands.max() << "\n";
+        out << "Avg Island\t"<< method_name << "\t" << average_islands.min() << "\t" << average_islands.mean() << "\t" << average_islands.stdev() << "\t" << average_islands.max() << "\n";
+    }
+};
+
+/*! \brief Function, that summarises all records of one sequence file.
+ *  Records are read in batches, every batch is shared by the threads, which pull one record after another. Every
+ *  thread has its own statistics, which are merged at the end.
+ *  \tparam statistics_t The statistics, e.g. distance_statistics, must be mergeable.
  *  \param sequence_file A sequence file.
- *  \param kmer_view View to compare to (Should be k-mers in most cases or minimisers with window length = kmer length).
- *  \param input_view View that should be evaluated.
- *  \param method_name Name of the tested method.
- *  \param args The arguments about the view to be used, needed for strobemers.
+ *  \param threads The number of threads to use.
+ *  \param add_record Adds a record to the statistics of a thread, is called by several threads at once.
+ *  \returns The statistics of all records.
  */
-template <typename urng_t, typename urng_t2>
-void compare_cov(std::filesystem::path sequence_file, urng_t kmer_view, urng_t2 input_view, std::string method_name, range_arguments & args)
+template <typename statistics_t, typename add_record_t>
+statistics_t coverage_of_file(std::filesystem::path const & sequence_file, size_t const threads, add_record_t const & add_record)
 {
-    std::vector<int> islands{};
-    int island{};
-    int covered{};
-    std::vector<int> avg_islands{};
-    std::vector<int> largest_islands{};
-    std::vector<int> covered_percentage{};
-    std::vector<int> covereage_avg{};
-    std::ofstream outfile;
+    // A batch holds at least one record per thread and about 1 MiB bases per thread.
+    size_t const batch_bases = threads << 20;
+
+    std::vector<statistics_t> thread_coverage(threads);
+    std::vector<std::vector<seqan3::dna4>> batch{};
+    size_t bases{};
 
-    seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::id,seqan3::field::seq>> fin{sequence_file};
-    for (auto & [id, seq] : fin)
+    auto process_batch = [&] ()
     {
-        auto kmers = seq | kmer_view;
-        auto submers = seq | input_view;
+        std::atomic<size_t> next_record{0};
+        auto worker = [&] (size_t const thread)
+        {
+            for (size_t i = next_record++; i < batch.size(); i = next_record++)
+                add_record(thread_coverage[thread], batch[i]);
+        };
 
-        std::vector<uint32_t> covs{};
-        covs.assign(seq.size(), 0);
-        std::deque<uint64_t> submers2{};
+        std::vector<std::thread> workers{};
+        for (size_t thread = 1; thread < std::min(threads, batch.size()); ++thread)
+            workers.emplace_back(worker, thread);
+        worker(0);
+        for (auto & w : workers)
+            w.join();
 
-        for(auto && sub: submers)
-            submers2.push_back(sub);
-        coverage(kmers, submers2, covs, args.shape);
+        batch.clear();
+        bases = 0;
+    };
 
-        int i{0};
-        for(auto & elem : covs)
-        {
-            if (elem == 0)
-            {
-                island++;
-            }
-            else
-            {
-                if (island > 0)
-                {
-                    if (island >23)
-                        std::cout << i << " " << island << ", " << id<< "\n";
-                    islands.push_back(island);
-                    island = 0;
-                }
-                covered++;
-            }
-            i++;
-        }
+    seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_file};
+    for (auto & [seq] : fin)
+    {
+        bases += seq.size();
+        batch.push_back(std::move(seq));
+        if (batch.size() >= threads && bases >= batch_bases)
+            process_batch();
+    }
+    process_batch();
 
-        if (island > 0)
-        {
-            if (island >23)
-                std::cout << i << " " << island << ", " << id<< "\n";
-            islands.push_back(island);
-            island = 0;
-        }
+    for (size_t thread = 1; thread < threads; ++thread)
+        thread_coverage[0].merge(thread_coverage[thread]);
+    return thread_coverage[0];
+}
 
-        covered_percentage.push_back(covered);
+/*! \brief Function, that summarises all sequence files and writes the statistics of all files and, if there are
+ *  several files, of every file.
+ *  \tparam statistics_t The statistics, e.g. distance_statistics.
+ *  \param sequence_files A vector of sequence files.
+ *  \param add_record Adds a record to the statistics of a thread, is called by several threads at once.
+ *  \param method_name Name of the tested method.
+ *  \param args The arguments about the view to be used.
+ */
+template <typename statistics_t, typename add_record_t>
+void write_coverage(std::vector<std::filesystem::path> const & sequence_files,
+                    add_record_t const & add_record,
+                    std::string const & method_name,
+                    range_arguments & args)
+{
+    statistics_t coverage{};
+    std::ofstream outfile;
 
-        double mean_cov{};
-        double var_cov{};
-        get_mean_and_var(covs, mean_cov, var_cov);
-        covereage_avg.push_back(mean_cov);
+    for (auto const & sequence_file : sequence_files)
+    {
+        statistics_t const file_coverage = coverage_of_file<statistics_t>(sequence_file, args.threads, add_record);
+        coverage.merge(file_coverage);
 
-        if (islands.size() == 0)
+        // Store coverage per file, if there are several files
+        if (sequence_files.size() > 1)
         {
-            avg_islands.push_back(0);
-            largest_islands.push_back(0);
+            outfile.open(std::string{args.path_out} + method_name + "_" + std::string{sequence_file.stem()} + "_coverage.out");
+            file_coverage.write(outfile, method_name);
+            outfile.close();
         }
-        else
-        {
-            double mean{};
-            double var{};
-            get_mean_and_var(islands, mean, var);
-            avg_islands.push_back(mean);
-            largest_islands.push_back(*std::max_element(islands.begin(), islands.end()));
-        }
-
-        islands.clear();
-        island = 0;
-        covered = 0;
     }
 
-    double mean_covered, mean_largest_island, mean_avg_island, stdev_covered, stdev_largest_island, stdev_avg_island;
-    get_mean_and_var(covered_percentage, mean_covered, stdev_covered);
-    get_mean_and_var(largest_islands, mean_largest_island, stdev_largest_island);
-    get_mean_and_var(avg_islands, mean_avg_island, stdev_avg_island);
-
-    std::nth_element(covereage_avg.begin(), covereage_avg.begin() + covereage_avg.size()/2, covereage_avg.end());
-    int median = covereage_avg[covereage_avg.size()/2];
-
-    // Store speed and counts
+    // Store coverage
     outfile.open(std::string{args.path_out} + method_name + "_coverage.out");
-    outfile << "Covered\t"<< method_name << "\t" << *std::min_element(covered_percentage.begin(), covered_percentage.end()) << "\t" << mean_covered << "\t" << stdev_covered << "\t" << *std::max_element(covered_percentage.begin(), covered_percentage.end()) << "\n";
-    outfile << "Covered Median\t"<< method_name << "\t" << *std::min_element(covereage_avg.begin(), covereage_avg.end()) << "\t" << median << "\t" << *std::max_element(covereage_avg.begin(), covereage_avg.end()) << "\n";
-    outfile << "Largest Island\t"<< method_name << "\t" << *std::min_element(largest_islands.begin(), largest_islands.end()) << "\t" << mean_largest_island << "\t" << stdev_largest_island << "\t" << *std::max_element(largest_islands.begin(), largest_islands.end()) << "\n";
-    outfile << "Avg Island\t"<< method_name << "\t" << *std::min_element(avg_islands.begin(), avg_islands.end()) << "\t" << mean_avg_island << "\t" << stdev_avg_island << "\t" << *std::max_element(avg_islands.begin(), avg_islands.end()) << "\n";
+    coverage.write(outfile, method_name);
     outfile.close();
 }
 
+/*! \brief Function, get the coverage and the islands of sequence files for a method.
+ *  Every submer covers the positions of its shape, starting at the position reported by the view, so the coverage is
+ *  obtained in a single pass over the submers. Covered positions are stored as a bitvector, the average coverage
+ *  follows from the number of submers.
+ *  \param sequence_files A vector of sequence files.
+ *  \param input_view View that should be evaluated, must return (hash, position) pairs, e.g. modmer_hash_position.
+ *  \param method_name Name of the tested method.
+ *  \param args The arguments about the view to be used.
+ */
 template <typename urng_t>
-void compare_cov2(std::filesystem::path sequence_file, urng_t distance_view, std::string method_name, range_arguments & args)
+void compare_cov(std::vector<std::filesystem::path> sequence_files, urng_t input_view, std::string method_name, range_arguments & args)
 {
-    std::vector<double> coverage{};
-    std::vector<double> stdev{};
-    std::ofstream outfile;
-
-    seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_file};
-    for (auto & [seq] : fin)
+    seqan3::shape const shape = args.shape;
+    write_coverage<island_statistics>(sequence_files, [&] (island_statistics & statistics, std::vector<seqan3::dna4> & seq)
     {
-        for (auto && hash : seq | distance_view)
-            coverage.push_back(hash);
-    }
-    double mean_coverage, stdev_coverage;
-    get_mean_and_var(coverage, mean_coverage, stdev_coverage);
+        coverage_bitvector covs{seq.size(), shape};
+        uint64_t submers{};
+        for (auto && [hash, position] : seq | input_view)
+        {
+            covs.cover(position);
+            submers++;
+        }
+        statistics.push(covs, submers, shape.count(), seq.size());
+    }, method_name, args);
+}
 
-    // Store coverage
-    outfile.open(std::string{args.path_out} + method_name + "_coverage.out");
-    outfile << method_name << "\t" << *std::min_element(coverage.begin(), coverage.end()) << "\t" << mean_coverage << "\t" << stdev_coverage << "\t" << *std::max_element(coverage.begin(), coverage.end()) << "\n";
-    outfile.close();
+/*! \brief Function, get the coverage of sequence files for a method, given by the distances between submers.
+ *  \param sequence_files A vector of sequence files.
+ *  \param distance_view View that should be evaluated, must return distances, e.g. modmer_hash_distance.
+ *  \param method_name Name of the tested method.
+ *  \param args The arguments about the view to be used.
+ */
+template <typename urng_t>
+void compare_cov2(std::vector<std::filesystem::path> sequence_files, urng_t distance_view, std::string method_name, range_arguments & args)
+{
+    write_coverage<distance_statistics>(sequence_files, [&] (distance_statistics & statistics, std::vector<seqan3::dna4> & seq)
+    {
+        for (auto && distance : seq | distance_view)
+            statistics.push(distance);
+    }, method_name, args);
 }
 
 /*! \brief Function, that measures the speed of a method.
@@ -398,7 +921,7 @@ void compare_cov2(std::filesystem::path sequence_file, urng_t distance_view, std
  *  \param method_name Name of the tested method.
  *  \param args The arguments about the view to be used, needed for strobemers.
  */
-template <typename urng_t, int strobemers = 0>
+template <typename urng_t>
 void speed(std::vector<std::filesystem::path> sequence_files, urng_t input_view, std::string method_name, range_arguments & args)
 {
    std::vector<int> speed_results{};
@@ -408,25 +931,11 @@ void speed(std::vector<std::filesystem::path> sequence_files, urng_t input_view,
    {
        robin_hood::unordered_node_map<uint64_t, uint16_t> hash_table{};
        auto start = std::chrono::high_resolution_clock::now();
-       if constexpr (strobemers > 0)
-       {
-           seqan3::sequence_file_input<my_traits2, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
-           for (auto & [seq] : fin)
-           {
-               std::vector<std::tuple<uint64_t, unsigned int, unsigned int, unsigned int, unsigned int>> strobes_vector;
-               get_strobemers<strobemers>(seq, args, strobes_vector);
-               for (auto & t : strobes_vector) // iterate over the strobemer tuples
-                   count++;
-           }
-       }
-       else
+       seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
+       for (auto & [seq] : fin)
        {
-           seqan3::sequence_file_input<my_traits, seqan3::fields<seqan3::field::seq>> fin{sequence_files[i]};
-           for (auto & [seq] : fin)
-           {
-               for (auto && hash : seq | input_view)
-                   count++;
-           }
+           for (auto && hash : seq | input_view)
+               count++;
        }
        auto end = std::chrono::high_resolution_clock::now();
        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -463,6 +972,24 @@ void do_accuracy(accuracy_arguments & args)
                                      "opensyncmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get())+ "_" + std::to_string(args.t), args);
                         break;
                     }
+        case strobemer: {
+                        if (args.rand & (args.order == 2))
+                            accuracy(randstrobe_hash<2>(args.shape, args.w_min, args.w_max, args.seed_se),
+                                     "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        else if (args.rand & (args.order == 3))
+                            accuracy(randstrobe_hash<3>(args.shape, args.w_min, args.w_max, args.seed_se),
+                                     "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        else if (args.hybrid)
+                            accuracy(hybridstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
+                                     "hybridstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        else if (args.minstrobers & (args.order == 2))
+                            accuracy(minstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
+                                     "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        else if (args.minstrobers & (args.order == 3))
+                            accuracy(minstrobe3_hash(args.shape, args.w_min, args.w_max, args.seed_se),
+                                     "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        break;
+                    }
     }
 }
 
@@ -488,34 +1015,91 @@ void do_counts(std::vector<std::filesystem::path> sequence_files, range_argument
                             break;
                         }
         case strobemer: {
-                            std::ranges::empty_view<seqan3::detail::empty_type> empty{};
                             if (args.rand & (args.order == 2))
-                                counts<std::ranges::empty_view<seqan3::detail::empty_type>, 1>(sequence_files, empty,
+                                counts(sequence_files, randstrobe_hash<2>(args.shape, args.w_min, args.w_max, args.seed_se),
                                     "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
                             else if (args.rand & (args.order == 3))
-                                counts<std::ranges::empty_view<seqan3::detail::empty_type>, 2>(sequence_files, empty,
+                                counts(sequence_files, randstrobe_hash<3>(args.shape, args.w_min, args.w_max, args.seed_se),
                                     "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
                             else if (args.hybrid)
-                                counts<std::ranges::empty_view<seqan3::detail::empty_type>, 3>(sequence_files, empty,
+                                counts(sequence_files, hybridstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
                                     "hybridstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
-                            else if (args.minstrobers)
-                                counts<std::ranges::empty_view<seqan3::detail::empty_type>, 4>(sequence_files, empty,
+                            else if (args.minstrobers & (args.order == 2))
+                                counts(sequence_files, minstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
+                                    "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                            else if (args.minstrobers & (args.order == 3))
+                                counts(sequence_files, minstrobe3_hash(args.shape, args.w_min, args.w_max, args.seed_se),
                                     "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
                             break;
                         }
     }
 }
 
-void do_coverage(std::filesystem::path sequence_file, range_arguments & args)
+void do_coverage(std::vector<std::filesystem::path> sequence_files, coverage_arguments & args)
 {
+    // The islands need the positions of the submers.
+    if (args.islands)
+    {
+        switch(args.name)
+        {
+            case minimiser: compare_cov(sequence_files, minimiser_hash_position(args.shape,
+                                    args.w_size, args.seed_se), "minimiser_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get()), args);
+                            break;
+            case modmers: compare_cov(sequence_files, modmer_hash_position(args.shape,
+                                    args.w_size.get(), args.seed_se), "modmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get()), args);
+                            break;
+            case syncmer:  {
+                                if (args.closed)
+                                    compare_cov(sequence_files, syncmer_hash_position<false>(args.w_size.get(), args.k_size, args.t, args.seed_se),
+                                    "closedsyncmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get())+ "_" + std::to_string(args.t), args);
+                                else
+                                    compare_cov(sequence_files, syncmer_hash_position<true>(args.w_size.get(), args.k_size, args.t, args.seed_se),
+                                    "opensyncmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get())+ "_" + std::to_string(args.t), args);
+                                break;
+                            }
+            case strobemer: {
+                                if (args.minstrobers & (args.order == 2))
+                                    compare_cov(sequence_files, minstrobe_hash_position(args.shape, args.w_min, args.w_max, args.seed_se),
+                                        "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                                else if (args.minstrobers & (args.order == 3))
+                                    compare_cov(sequence_files, minstrobe3_hash_position(args.shape, args.w_min, args.w_max, args.seed_se),
+                                        "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                                break;
+                            }
+            default: break;
+        }
+        return;
+    }
+
     switch(args.name)
     {
-        case minimiser: compare_cov2(sequence_file, minimiser_hash_distance(args.shape,
+        case minimiser: compare_cov2(sequence_files, minimiser_hash_distance(args.shape,
                                 args.w_size, args.seed_se), "minimiser_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get()), args);
                         break;
-        case modmers: compare_cov2(sequence_file, modmer_hash_distance(args.shape,
+        case modmers: compare_cov2(sequence_files, modmer_hash_distance(args.shape,
                                 args.w_size.get(), args.seed_se), "modmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get()), args);
                         break;
+        case syncmer:  {
+                            if (args.closed)
+                                compare_cov2(sequence_files, syncmer_hash_distance<false>(args.w_size.get(), args.k_size, args.t, args.seed_se),
+                                "closedsyncmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get())+ "_" + std::to_string(args.t), args);
+                            else
+                                compare_cov2(sequence_files, syncmer_hash_distance<true>(args.w_size.get(), args.k_size, args.t, args.seed_se),
+                                "opensyncmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get())+ "_" + std::to_string(args.t), args);
+                            break;
+                        }
+        case strobemer: {
+                            if (args.hybrid)
+                                compare_cov2(sequence_files, hybridstrobe_hash_distance(args.shape, args.w_min, args.w_max, args.seed_se),
+                                    "hybridstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                            else if (args.minstrobers & (args.order == 2))
+                                compare_cov2(sequence_files, minstrobe_hash_distance(args.shape, args.w_min, args.w_max, args.seed_se),
+                                    "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                            else if (args.minstrobers & (args.order == 3))
+                                compare_cov2(sequence_files, minstrobe3_hash_distance(args.shape, args.w_min, args.w_max, args.seed_se),
+                                    "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                            break;
+                        }
     }
 }
 
@@ -531,18 +1115,20 @@ void do_speed(std::vector<std::filesystem::path> sequence_files, range_arguments
         case modmers: speed(sequence_files, modmer_hash(args.shape,
                                 args.w_size.get(), args.seed_se), "modmer_hash_" + std::to_string(args.k_size) + "_" + std::to_string(args.w_size.get()), args);
                         break;
-        case strobemer: std::ranges::empty_view<seqan3::detail::empty_type> empty{};
-                        if (args.rand & (args.order == 2))
-                            speed<std::ranges::empty_view<seqan3::detail::empty_type>, 1>(sequence_files, empty,
+        case strobemer: if (args.rand & (args.order == 2))
+                            speed(sequence_files, randstrobe_hash<2>(args.shape, args.w_min, args.w_max, args.seed_se),
                                 "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
                         else if (args.rand & (args.order == 3))
-                            speed<std::ranges::empty_view<seqan3::detail::empty_type>, 2>(sequence_files, empty,
+                            speed(sequence_files, randstrobe_hash<3>(args.shape, args.w_min, args.w_max, args.seed_se),
                                 "randstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
                         else if (args.hybrid)
-                            speed<std::ranges::empty_view<seqan3::detail::empty_type>, 3>(sequence_files, empty,
+                            speed(sequence_files, hybridstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
                                 "hybridstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
-                        else if (args.minstrobers)
-                            speed<std::ranges::empty_view<seqan3::detail::empty_type>, 4>(sequence_files, empty,
+                        else if (args.minstrobers & (args.order == 2))
+                            speed(sequence_files, minstrobe_hash(args.shape, args.w_min, args.w_max, args.seed_se),
+                                "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
+                        else if (args.minstrobers & (args.order == 3))
+                            speed(sequence_files, minstrobe3_hash(args.shape, args.w_min, args.w_max, args.seed_se),
                                 "minstrobemers_" + std::to_string(args.k_size) + "_" + std::to_string(args.order) + "_" +  std::to_string(args.w_min) + "_" +  std::to_string(args.w_max), args);
     }
 }
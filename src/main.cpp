@@ -46,6 +46,12 @@ void read_range_arguments_syncmers(seqan3::argument_parser & parser, range_argum
     parser.add_option(args.t, 't', "t_vlue", "The offset for the position of the smallest sub-window.");
 }
 
+void read_threads_argument(seqan3::argument_parser & parser, range_arguments & args)
+{
+    parser.add_option(args.threads, '\0', "threads", "The number of threads to use.",
+                      seqan3::option_spec::standard, seqan3::arithmetic_range_validator{1, 1024});
+}
+
 void read_range_arguments_minimiser(seqan3::argument_parser & parser, range_arguments & args)
 {
     parser.add_option(w_size, 'w', "window", "Define window size. Default: 60.");
@@ -79,27 +85,90 @@ int accuracy(seqan3::argument_parser & parser)
     std::string method{};
     parser.add_option(method, '\0', "method", "Pick your method.",
                       seqan3::option_spec::required,
-                      seqan3::value_list_validator{"kmer", "minimiser", "modmer", "syncmer"});
+                      seqan3::value_list_validator{"kmer", "minimiser", "modmer", "strobemer", "syncmer"});
     parser.add_option(args.search_file, '\0', "search-file", "A sequence files with sequences to search for.",
                       seqan3::option_spec::required);
     parser.add_option(args.solution_file, '\0', "solution-file", "A file giving the correct files a sequence should be find in.",
                       seqan3::option_spec::required);
-    parser.add_option(args.ibfsize, '\0', "ibfsize", "The size of the ibf.",
+    parser.add_option(args.ibfsize, '\0', "ibfsize",
+                      "The size of the ibf. Default: The smallest size, that reaches the false positive rate. "
+                      "Cannot be combined with --hierarchical, --exact or --xor-filters.",
                       seqan3::option_spec::advanced);
     parser.add_option(args.number_hashes, '\0', "number-hashes",
-                      "The number of hashes to use.",
+                      "The number of hashes to use. Only used together with --ibfsize.",
                       seqan3::option_spec::advanced);
-    parser.add_option(args.threshold, '\0', "threshold",
-                      "The threshold to use for the search.",
+    parser.add_option(args.fpr, '\0', "fpr",
+                      "The false positive rate of the largest bin, that the ibf size is derived from, if no "
+                      "--ibfsize is given. Must be greater than 0 and smaller than 1.",
+                      seqan3::option_spec::advanced,
+                      seqan3::arithmetic_range_validator{0, 1});
+    std::vector<float> thresholds{};
+    parser.add_option(thresholds, '\0', "threshold",
+                      "The threshold to use for the search. Can be given several times, then all thresholds are "
+                      "evaluated in one search and the accuracy file gets one line per threshold. Default: 0.5.",
                       seqan3::option_spec::advanced);
+    parser.add_flag(args.no_store, '\0', "no-store",
+                    "If an ibf created from the input files should not be stored.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.compressed, '\0', "compressed",
+                    "If the ibf should be searched in the compressed layout, which needs less memory, but is slower. "
+                    "Cannot be combined with another index than the ibf.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.hierarchical, '\0', "hierarchical",
+                    "If a hierarchical ibf should be created, which needs less memory for bins of very different "
+                    "sizes. It is stored as .hibf. Only one of --hierarchical, --blocked, --exact and --xor-filters "
+                    "can be given.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.blocked, '\0', "blocked",
+                    "If a blocked ibf should be created, in which a query reads one cache line per 64 bins, but which "
+                    "needs more memory for the same false positive rate. It is stored as .bibf.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.dedup, '\0', "dedup",
+                    "If every distinct submer of a read should be looked up only once. The counts stay the same, this "
+                    "is faster for long reads with repeats. Cannot be combined with --hierarchical.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.exact, '\0', "exact",
+                    "If an exact index without false positives should be created instead of an ibf, which stores every "
+                    "distinct submer with its bins. It is stored as .exact.",
+                    seqan3::option_spec::advanced);
+    parser.add_flag(args.xor_filters, '\0', "xor-filters",
+                    "If an xor filter per bin should be created instead of an ibf, which needs about 1.23 times the "
+                    "optimal memory for the false positive rate given by --fpr. It is stored as .xor.",
+                    seqan3::option_spec::advanced);
+    read_threads_argument(parser, args);
 
     read_range_arguments_minimiser(parser, args);
+    read_range_arguments_strobemers(parser, args);
     read_range_arguments_syncmers(parser, args);
 
     try
     {
         parser.parse();
         parsing(args);
+        if (!thresholds.empty())
+            args.thresholds = thresholds;
+        if (args.fpr <= 0 || args.fpr >= 1)
+            throw seqan3::argument_parser_error{"The false positive rate must be greater than 0 and smaller than 1."};
+
+        // Only one index can be created and the options of the interleaved ibf are not used by every other index.
+        std::string backend{};
+        for (auto && [flag, name] : {std::pair{args.hierarchical, "--hierarchical"},
+                                     std::pair{args.blocked, "--blocked"},
+                                     std::pair{args.exact, "--exact"},
+                                     std::pair{args.xor_filters, "--xor-filters"}})
+        {
+            if (!flag)
+                continue;
+            if (!backend.empty())
+                throw seqan3::argument_parser_error{backend + " and " + name + " cannot be combined."};
+            backend = name;
+        }
+        if (args.compressed && !backend.empty())
+            throw seqan3::argument_parser_error{"--compressed and " + backend + " cannot be combined."};
+        if (args.ibfsize != 0 && (args.hierarchical || args.exact || args.xor_filters))
+            throw seqan3::argument_parser_error{"--ibfsize and " + backend + " cannot be combined."};
+        if (args.dedup && args.hierarchical)
+            throw seqan3::argument_parser_error{"--dedup and --hierarchical cannot be combined."};
     }
     catch (seqan3::argument_parser_error const & ext)                     // catch user errors
     {
@@ -149,22 +218,37 @@ int counts(seqan3::argument_parser & parser)
 
 int coverage(seqan3::argument_parser & parser)
 {
-    range_arguments args{};
-    std::filesystem::path sequence_file{};
+    coverage_arguments args{};
+    std::vector<std::filesystem::path> sequence_files{};
     parser.info.short_description = "Estimates the coverage of the different methods.";
-    parser.add_positional_option(sequence_file, "Please provide one sequence file.");
+    parser.add_positional_option(sequence_files,
+                                 "Please provide at least one sequence file.");
     all_arguments(parser, args);
+    read_threads_argument(parser, args);
     std::string method{};
     parser.add_option(method, '\0', "method", "Pick your method.",
                       seqan3::option_spec::required,
-                      seqan3::value_list_validator{"kmer", "minimiser", "modmer"});
+                      seqan3::value_list_validator{"kmer", "minimiser", "modmer", "strobemer", "syncmer"});
+    parser.add_flag(args.islands, '\0', "islands",
+                    "If the covered positions and the islands, i.e. runs of uncovered positions, of every sequence "
+                    "should be reported instead of the distances between submers. Available for minimisers, modmers, "
+                    "syncmers and minstrobemers.",
+                    seqan3::option_spec::advanced);
 
     read_range_arguments_minimiser(parser, args);
+    read_range_arguments_strobemers(parser, args);
+    read_range_arguments_syncmers(parser, args);
 
     try
     {
         parser.parse();
         parsing(args);
+        if (args.islands && (method == "kmer" || (method == "strobemer" && !args.minstrobers)))
+            throw seqan3::argument_parser_error{"The islands are only available for minimisers, modmers, syncmers "
+                                                "and minstrobemers."};
+        if (method == "strobemer" && (args.rand || !(args.hybrid || args.minstrobers)))
+            throw seqan3::argument_parser_error{"The coverage of strobemers is only available for hybridstrobemers and "
+                                                "minstrobemers."};
     }
     catch (seqan3::argument_parser_error const & ext)                     // catch user errors
     {
@@ -173,7 +257,7 @@ int coverage(seqan3::argument_parser & parser)
     }
 
     string_to_methods(method, args.name);
-    do_coverage(sequence_file, args);
+    do_coverage(sequence_files, args);
 
     return 0;
 }
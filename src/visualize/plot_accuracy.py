@@ -10,19 +10,19 @@ def get_labels(name, method):
 
 name = sys.argv[1]
 name2 = sys.argv[2]
-all_fp = []
-all_fn = []
+# The false positives and false negatives per threshold. A file searched with several thresholds has one line per
+# threshold with the threshold after the method, otherwise there is no threshold column.
+all_fp = {}
+all_fn = {}
 labels = []
 for i in range(3, len(sys.argv)):
-    fp = 0
-    fn = 0
     with open(sys.argv[i]) as f:
         for line in f:
-            fp = int(line.split()[3])
-            fn = int(line.split()[4])
-            all_fp.append(fp)
-            all_fn.append(fn)
-            labels.append(get_labels(name, line.split()[0]))
+            fields = line.split()
+            threshold = fields[1] if len(fields) == 6 else ""
+            all_fp.setdefault(threshold, []).append(int(fields[-2]))
+            all_fn.setdefault(threshold, []).append(int(fields[-1]))
+    labels.append(get_labels(name, fields[0]))
 
 fig = plt.figure()
 ax = plt.axes()
@@ -30,11 +30,13 @@ ax = plt.axes()
 plt.title("Accuracy")
 plt.xlabel(name)
 plt.ylabel("Hits")
-ticks = [j for j in range(len(all_fp))]
+ticks = [j for j in range(len(labels))]
 plt.xticks(ticks, labels)
-x = [j for j in range(len(all_fp))]
-ax.plot(x, all_fp, color='blue', label = "False Positives")
-ax.plot(x, all_fn, color='black', label = "False Negatives")
+for threshold in all_fp:
+    suffix = " (" + threshold + ")" if threshold else ""
+    x = [j for j in range(len(all_fp[threshold]))]
+    line, = ax.plot(x, all_fp[threshold], label = "False Positives" + suffix)
+    ax.plot(x, all_fn[threshold], color=line.get_color(), linestyle='dashed', label = "False Negatives" + suffix)
 plt.legend()
 
 plt.savefig("Plot_"+name+"_"+name2+".png")
@@ -0,0 +1,65 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "batched_agent.hpp"
+
+// A batch gives the same bins as the agent of the ibf for every value.
+TEST(batched_agent, bulk_contains)
+{
+    for (size_t bins : {1, 64, 130, 600})
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins},
+                                             seqan3::bin_size{1000u},
+                                             seqan3::hash_function_count{3u}};
+        std::mt19937_64 engine{bins};
+        for (size_t i = 0; i < 3000; ++i)
+            ibf.emplace(engine() % 5000, seqan3::bin_index{engine() % bins});
+
+        std::vector<uint64_t> values{};
+        for (size_t i = 0; i < 100; ++i)
+            values.push_back(engine() % 5000);
+
+        auto agent = ibf.membership_agent();
+        batched_agent batched{ibf};
+        size_t const words = (bins + 63) / 64;
+        ASSERT_EQ(words, batched.words_per_value());
+        std::vector<uint64_t> const & result = batched.bulk_contains(values);
+        ASSERT_EQ(values.size() * words, result.size());
+        for (size_t v = 0; v < values.size(); ++v)
+        {
+            uint64_t const * const expected = agent.bulk_contains(values[v]).raw_data().data();
+            for (size_t w = 0; w < words; ++w)
+                EXPECT_EQ(expected[w], result[v * words + w]);
+        }
+
+        EXPECT_TRUE(batched.bulk_contains(std::vector<uint64_t>{}).empty());
+    }
+}
+
+// The mapped ibf is searched the same way.
+TEST(batched_agent, mapped_ibf)
+{
+    std::filesystem::path const path{std::string{std::filesystem::temp_directory_path()} + "/batched_agent_test.ibf"};
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{70u},
+                                         seqan3::bin_size{500u},
+                                         seqan3::hash_function_count{2u}};
+    std::mt19937_64 engine{42};
+    for (size_t i = 0; i < 1000; ++i)
+        ibf.emplace(engine() % 2000, seqan3::bin_index{engine() % 70});
+    store_mapped_ibf(ibf, path, mapped_ibf_header{});
+
+    std::vector<uint64_t> values{};
+    for (size_t i = 0; i < 50; ++i)
+        values.push_back(engine() % 2000);
+    {
+        mapped_ibf mapped{path};
+        batched_agent from_memory{ibf};
+        batched_agent from_file{mapped};
+        std::vector<uint64_t> const expected = from_memory.bulk_contains(values);
+        EXPECT_EQ(expected, from_file.bulk_contains(values));
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,141 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bit_sliced_counter.hpp"
+
+TEST(bit_sliced_counter, empty)
+{
+    bit_sliced_counter counter{70};
+    std::vector<uint64_t> result{};
+
+    EXPECT_EQ(70u, counter.bin_count());
+    EXPECT_EQ(0u, counter.count(0));
+    EXPECT_EQ(0u, counter.count(69));
+
+    counter.greater_equal(0, result);
+    EXPECT_EQ((std::vector<uint64_t>{~uint64_t{}, 0b111111}), result);
+    counter.greater_equal(1, result);
+    EXPECT_EQ((std::vector<uint64_t>{0, 0}), result);
+}
+
+TEST(bit_sliced_counter, add)
+{
+    bit_sliced_counter counter{3};
+    std::vector<uint64_t> result{};
+    for (uint64_t hits : {0b001, 0b011, 0b111, 0b011, 0b001})
+        counter.add(&hits);
+
+    EXPECT_EQ(5u, counter.count(0));
+    EXPECT_EQ(3u, counter.count(1));
+    EXPECT_EQ(1u, counter.count(2));
+
+    counter.greater_equal(3, result);
+    EXPECT_EQ((std::vector<uint64_t>{0b011}), result);
+    counter.greater_equal(6, result);
+    EXPECT_EQ((std::vector<uint64_t>{0}), result);
+    counter.greater_equal(100, result);
+    EXPECT_EQ((std::vector<uint64_t>{0}), result);
+
+    counter.clear();
+    EXPECT_EQ(0u, counter.count(0));
+    uint64_t hits{0b100};
+    counter.add(&hits);
+    EXPECT_EQ(0u, counter.count(0));
+    EXPECT_EQ(1u, counter.count(2));
+}
+
+// Compares to plain counters for random hits and all thresholds.
+TEST(bit_sliced_counter, random)
+{
+    size_t const bins{150};
+    std::mt19937_64 engine{42};
+    bit_sliced_counter counter{bins};
+    std::vector<uint64_t> result{};
+
+    for (size_t round = 0; round < 3; ++round)
+    {
+        counter.clear();
+        std::vector<uint64_t> expected(bins, 0);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            // Different densities, so that the counts differ a lot.
+            std::vector<uint64_t> hits{engine() & engine(), engine(), engine() | engine()};
+            hits.back() &= (uint64_t{1} << (bins % 64)) - 1;
+            counter.add(hits.data());
+            for (size_t bin = 0; bin < bins; ++bin)
+                expected[bin] += (hits[bin / 64] >> (bin % 64)) & 1;
+        }
+
+        for (size_t bin = 0; bin < bins; ++bin)
+            EXPECT_EQ(expected[bin], counter.count(bin));
+
+        for (uint64_t threshold = 0; threshold <= 101; ++threshold)
+        {
+            counter.greater_equal(threshold, result);
+            for (size_t bin = 0; bin < bins; ++bin)
+                EXPECT_EQ(expected[bin] >= threshold, (result[bin / 64] >> (bin % 64)) & 1);
+        }
+    }
+}
+
+TEST(bit_sliced_counter, undecided)
+{
+    bit_sliced_counter counter{3};
+    std::vector<uint64_t> result{};
+    for (uint64_t hits : {0b001, 0b011, 0b011})
+        counter.add(&hits);
+
+    // Counts 3, 2, 0 with threshold 3: bin 0 is accepted, bin 2 needs 3 more hits.
+    EXPECT_TRUE(counter.undecided(3, 3, result));
+    EXPECT_EQ((std::vector<uint64_t>{0b110}), result);
+    EXPECT_TRUE(counter.undecided(3, 1, result));
+    EXPECT_EQ((std::vector<uint64_t>{0b010}), result);
+    EXPECT_FALSE(counter.undecided(3, 0, result));
+    EXPECT_EQ((std::vector<uint64_t>{0}), result);
+
+    // Only the masked bins are counted.
+    uint64_t const hits{0b111};
+    counter.add(&hits, result.data());
+    EXPECT_EQ(3u, counter.count(0));
+    EXPECT_EQ(2u, counter.count(1));
+    uint64_t const mask{0b100};
+    counter.add(&hits, &mask);
+    EXPECT_EQ(3u, counter.count(0));
+    EXPECT_EQ(1u, counter.count(2));
+}
+
+// Stopping, once all bins are decided, finds the same bins as counting all hits.
+TEST(bit_sliced_counter, early_termination)
+{
+    size_t const bins{100};
+    std::mt19937_64 engine{7};
+    bit_sliced_counter all{bins};
+    bit_sliced_counter pruned{bins};
+    std::vector<uint64_t> expected{};
+    std::vector<uint64_t> result{};
+    std::vector<uint64_t> undecided{};
+
+    for (uint64_t threshold = 0; threshold <= 51; ++threshold)
+    {
+        std::vector<std::vector<uint64_t>> read{};
+        for (size_t i = 0; i < 50; ++i)
+            read.push_back({engine() | engine(), (engine() & engine()) & ((uint64_t{1} << (bins % 64)) - 1)});
+
+        all.clear();
+        pruned.clear();
+        for (auto const & hits : read)
+            all.add(hits.data());
+        for (size_t i = 0; i < read.size(); ++i)
+        {
+            if (i % 16 == 0 && !pruned.undecided(threshold, read.size() - i, undecided))
+                break;
+            pruned.add(read[i].data(), undecided.data());
+        }
+
+        all.greater_equal(threshold, expected);
+        pruned.greater_equal(threshold, result);
+        EXPECT_EQ(expected, result);
+    }
+}
@@ -0,0 +1,120 @@
+#include <bit>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "blocked_ibf.hpp"
+#include "ibf_sizing.hpp"
+
+TEST(blocked_ibf, parameters)
+{
+    blocked_ibf ibf{seqan3::bin_count{70u}, seqan3::bin_size{1001u}, seqan3::hash_function_count{2u}};
+    EXPECT_EQ(70u, ibf.bin_count());
+    EXPECT_EQ(1008u, ibf.bin_size());
+    EXPECT_EQ(2u, ibf.hash_function_count());
+
+    EXPECT_THROW((blocked_ibf{seqan3::bin_count{70u}, seqan3::bin_size{1000u}, seqan3::hash_function_count{6u}}),
+                 std::logic_error);
+    EXPECT_THROW((blocked_ibf{seqan3::bin_count{0u}, seqan3::bin_size{1000u}, seqan3::hash_function_count{1u}}),
+                 std::logic_error);
+}
+
+// Every inserted value is found in its bin, values, that were not inserted, are found at most as often as expected.
+TEST(blocked_ibf, bulk_contains)
+{
+    size_t const bins{130};
+    for (size_t hash_count : {1, 2, 3, 5})
+    {
+        blocked_ibf ibf{seqan3::bin_count{bins}, seqan3::bin_size{8192u}, seqan3::hash_function_count{hash_count}};
+        std::mt19937_64 engine{hash_count};
+        std::vector<std::vector<uint64_t>> values(bins);
+        for (size_t bin = 0; bin < bins; ++bin)
+        {
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                values[bin].push_back(engine());
+                ibf.emplace(values[bin].back(), seqan3::bin_index{bin});
+            }
+        }
+
+        auto agent = ibf.membership_agent();
+        for (size_t bin = 0; bin < bins; ++bin)
+            for (uint64_t const value : values[bin])
+                EXPECT_TRUE((agent.bulk_contains(value).raw_data()[bin / 64] >> (bin % 64)) & 1);
+
+        size_t false_positives{};
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            uint64_t const value = engine();
+            std::vector<uint64_t> const & hits = agent.bulk_contains(value).raw_data();
+            ASSERT_EQ(3u, hits.size());
+            // Bits after the last bin are never set.
+            EXPECT_EQ(0u, hits[2] >> (bins % 64));
+            for (uint64_t const word : hits)
+                false_positives += std::popcount(word);
+        }
+        double const expected = blocked_false_positive_rate(ibf.bin_size(), hash_count, 1000) * bins * 1000;
+        EXPECT_LT(0.5 * expected, false_positives);
+        EXPECT_GT(1.05 * expected + 100, false_positives);
+    }
+}
+
+// A batch gives the same bins as the single queries.
+TEST(blocked_ibf, batch)
+{
+    size_t const bins{130};
+    blocked_ibf ibf{seqan3::bin_count{bins}, seqan3::bin_size{1000u}, seqan3::hash_function_count{3u}};
+    std::mt19937_64 engine{42};
+    for (size_t i = 0; i < 3000; ++i)
+        ibf.emplace(engine() % 5000, seqan3::bin_index{engine() % bins});
+
+    std::vector<uint64_t> values{};
+    for (size_t i = 0; i < 100; ++i)
+        values.push_back(engine() % 5000);
+
+    auto agent = ibf.membership_agent();
+    std::vector<uint64_t> const result = agent.bulk_contains(std::span<uint64_t const>{values});
+    ASSERT_EQ(3 * values.size(), result.size());
+    for (size_t v = 0; v < values.size(); ++v)
+    {
+        std::vector<uint64_t> const & expected = agent.bulk_contains(values[v]).raw_data();
+        EXPECT_EQ(expected, (std::vector<uint64_t>{result.begin() + 3 * v, result.begin() + 3 * v + 3}));
+    }
+}
+
+// Inserting from several threads into the same bins gives the same ibf as inserting from one thread.
+TEST(blocked_ibf, concurrent_emplace)
+{
+    size_t const bins{70};
+    blocked_ibf expected{seqan3::bin_count{bins}, seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+    blocked_ibf ibf{seqan3::bin_count{bins}, seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+    std::mt19937_64 engine{42};
+    std::vector<std::pair<uint64_t, size_t>> values{};
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        values.emplace_back(engine(), engine() % bins);
+        expected.emplace(values.back().first, seqan3::bin_index{values.back().second});
+    }
+
+    std::vector<std::thread> threads{};
+    for (size_t thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&, thread] ()
+        {
+            for (size_t i = thread; i < values.size(); i += 4)
+                ibf.emplace(values[i].first, seqan3::bin_index{values[i].second});
+        });
+    }
+    for (auto & thread : threads)
+        thread.join();
+
+    auto expected_agent = expected.membership_agent();
+    auto agent = ibf.membership_agent();
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        uint64_t const value = i < 2500 ? values[i].first : engine();
+        EXPECT_EQ(expected_agent.bulk_contains(value).raw_data(), agent.bulk_contains(value).raw_data());
+    }
+}
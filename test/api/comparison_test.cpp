@@ -1,3 +1,6 @@
+#include <fstream>
+#include <random>
+
 #include <gtest/gtest.h>
 
 #include <seqan3/test/expect_range_eq.hpp>
@@ -98,7 +101,53 @@ TEST(minions, accuracy_existing_ibf)
     args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/"};
     args.search_file = DATADIR"search.fasta";
     args.solution_file = DATADIR"expected_search_result.out";
-    args.threshold = 0.5;
+    args.thresholds = {0.5};
+    do_accuracy(args);
+
+    // Check search file
+    std::vector<std::string> expected{"test	0,", "test2	0,"};
+    int i{0};
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out"};
+    std::string line;
+    while (std::getline(infile, line))
+    {
+        std::istringstream iss(line);
+        EXPECT_EQ(expected[i], line);
+        i++;
+    }
+
+    // Check result file
+    std::string expected2{"minimiser_hash_19_19\t2\t0\t0\t0"};
+    std::ifstream infile2{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    if(infile2.is_open())
+    {
+        while(std::getline(infile2, line))
+        {
+            EXPECT_EQ(expected2, line);
+            i++;
+        }
+    }
+    infile2.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.ibf");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+}
+
+TEST(minions, accuracy_threads)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example.ibf"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/threads_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.thresholds = {0.5};
+    args.threads = 4;
     do_accuracy(args);
 
     // Check search file
@@ -126,9 +175,429 @@ TEST(minions, accuracy_existing_ibf)
     }
     infile2.close();
 
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_thresholds)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example.ibf"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/thresholds_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.thresholds = {0.5, 2};
+    do_accuracy(args);
+
+    // Check search file, which uses the first threshold
+    std::vector<std::string> expected{"test	0,", "test2	0,"};
+    int i{0};
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out"};
+    std::string line;
+    while (std::getline(infile, line))
+    {
+        EXPECT_EQ(expected[i], line);
+        i++;
+    }
+
+    // Check result file, no count can reach twice the number of hashes
+    std::vector<std::string> expected2{"minimiser_hash_19_19\t0.5\t2\t0\t0\t0", "minimiser_hash_19_19\t2\t0\t0\t0\t2"};
+    i = 0;
+    std::ifstream infile2{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    while (std::getline(infile2, line))
+    {
+        EXPECT_EQ(expected2[i], line);
+        i++;
+    }
+    EXPECT_EQ(2, i);
+    infile2.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_no_store)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.ibfsize = 1000000;
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/no_store_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.no_store = true;
+    do_accuracy(args);
+
+    // The ibf is only kept in memory
+    EXPECT_FALSE(std::filesystem::exists(std::string{args.path_out} + "minimiser_hash_19_19.ibf"));
+
+    // Check result file
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_compressed)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.ibfsize = 1000000;
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/compressed_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.compressed = true;
+    do_accuracy(args);
+
+    // The stored ibf is the uncompressed one
+    seqan3::interleaved_bloom_filter ibf{};
+    load_ibf(ibf, std::string{args.path_out} + "minimiser_hash_19_19.ibf");
+    auto agent = ibf.membership_agent();
+    std::vector<bool> expected_result(1, 1);
+    EXPECT_RANGE_EQ(expected_result, agent.bulk_contains(39030638997));
+
+    // Check result file
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
     std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.ibf");
     std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
     std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_auto_size)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/auto_size_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.fpr = 0.01;
+    do_accuracy(args);
+
+    // The bin size is derived from the number of minimisers of example1.fasta
+    seqan3::interleaved_bloom_filter ibf{};
+    load_ibf(ibf, std::string{args.path_out} + "minimiser_hash_19_19.ibf");
+    EXPECT_LT(0u, ibf.bin_size());
+    EXPECT_LE(1u, ibf.hash_function_count());
+
+    // Check result file
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.ibf");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_hierarchical)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/hierarchical_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.hierarchical = true;
+    do_accuracy(args);
+
+    // The stored hierarchical ibf gives the same result
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    args.input_file = {std::string{args.path_out} + "minimiser_hash_19_19.hibf"};
+    args.hierarchical = false;
+    do_accuracy(args);
+    infile.open(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.hibf");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+/*! \brief Searches one read of each of 70 bins with the interleaved ibf and with another index, which must both find
+ *  the bin of every read and only this bin. The bins span two words of 64 bins, so that a wrong mapping of bins is
+ *  detected. All files start with the prefix and are removed afterwards.
+ *  \param index  The flag of the other index.
+ *  \param prefix The prefix of the files in the temporary directory.
+ */
+void expect_same_bins_as_ibf(bool accuracy_arguments::* index, std::string const & prefix)
+{
+    size_t const bins{70};
+    std::filesystem::path const directory = std::filesystem::temp_directory_path();
+    std::mt19937_64 rng{42};
+    std::vector<std::filesystem::path> sequence_files{};
+    std::ofstream reads{directory / (prefix + "reads.fasta")};
+    std::ofstream solution{directory / (prefix + "solution.out")};
+    for (size_t bin = 0; bin < bins; ++bin)
+    {
+        std::string sequence(1000, 'A');
+        for (char & base : sequence)
+            base = "ACGT"[rng() % 4];
+        sequence_files.push_back(directory / (prefix + "bin" + std::to_string(bin) + ".fasta"));
+        std::ofstream{sequence_files.back()} << ">bin" << bin << "\n" << sequence << "\n";
+        reads << ">read" << bin << "\n" << sequence.substr(400, 150) << "\n";
+        solution << "read" << bin << "\t" << bin << "\n";
+    }
+    reads.close();
+    solution.close();
+
+    // The bins are the binary files of the minimisers of the sequences.
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.path_out = directory / prefix;
+    do_counts(sequence_files, args);
+    for (auto const & sequence_file : sequence_files)
+        args.input_file.push_back(std::string{args.path_out} + "minimiser_hash_19_19_" +
+                                  std::string{sequence_file.stem()} + ".out");
+    args.search_file = directory / (prefix + "reads.fasta");
+    args.solution_file = directory / (prefix + "solution.out");
+
+    auto read_lines = [] (std::string const & path)
+    {
+        std::vector<std::string> lines{};
+        std::ifstream infile{path};
+        std::string line;
+        while (std::getline(infile, line))
+            lines.push_back(line);
+        return lines;
+    };
+    std::string const output = std::string{args.path_out} + "minimiser_hash_19_19_" +
+                               std::string{args.search_file.stem()};
+    std::vector<std::string> const expected{"minimiser_hash_19_19\t70\t4830\t0\t0"};
+
+    do_accuracy(args);
+    EXPECT_EQ(expected, read_lines(output + "_accuracy.out"));
+    std::vector<std::string> const found = read_lines(output + ".search_out");
+    EXPECT_EQ(bins, found.size());
+
+    args.*index = true;
+    do_accuracy(args);
+    EXPECT_EQ(expected, read_lines(output + "_accuracy.out"));
+    EXPECT_EQ(found, read_lines(output + ".search_out"));
+
+    std::vector<std::filesystem::path> files{};
+    for (auto const & entry : std::filesystem::directory_iterator{directory})
+        if (entry.path().filename().string().starts_with(prefix))
+            files.push_back(entry.path());
+    for (auto const & file : files)
+        std::filesystem::remove(file);
+}
+
+TEST(minions, accuracy_hierarchical_bins)
+{
+    expect_same_bins_as_ibf(&accuracy_arguments::hierarchical, "hierarchical_bins_");
+}
+
+TEST(minions, accuracy_blocked)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/blocked_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.blocked = true;
+    do_accuracy(args);
+
+    // The stored blocked ibf gives the same result
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    args.input_file = {std::string{args.path_out} + "minimiser_hash_19_19.bibf"};
+    args.blocked = false;
+    do_accuracy(args);
+    infile.open(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    // The performance file has the reads per second and the false positive rate
+    infile.open(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+    std::string method;
+    double reads_per_second{};
+    double fpr{1};
+    ASSERT_TRUE(infile >> method >> reads_per_second >> fpr);
+    EXPECT_EQ("minimiser_hash_19_19", method);
+    EXPECT_LT(0, reads_per_second);
+    EXPECT_EQ(0, fpr);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.bibf");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+}
+
+TEST(minions, accuracy_blocked_bins)
+{
+    expect_same_bins_as_ibf(&accuracy_arguments::blocked, "blocked_bins_");
+}
+
+TEST(minions, accuracy_dedup)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example.ibf"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/dedup_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.dedup = true;
+    do_accuracy(args);
+
+    // The counts, and so the results, are the same as without deduplication
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_exact)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/exact_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.exact = true;
+    do_accuracy(args);
+
+    // The stored exact index gives the same result
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    args.input_file = {std::string{args.path_out} + "minimiser_hash_19_19.exact"};
+    args.exact = false;
+    do_accuracy(args);
+    infile.open(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.exact");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_exact_bins)
+{
+    expect_same_bins_as_ibf(&accuracy_arguments::exact, "exact_bins_");
+}
+
+TEST(minions, accuracy_xor)
+{
+    accuracy_arguments args{};
+    args.name = minimiser;
+    args.k_size = 19;
+    args.w_size = seqan3::window_size{19};
+    args.shape = seqan3::ungapped{19};
+    args.seed_se = seqan3::seed{adjust_seed(args.k_size)};
+    args.input_file = {DATADIR"example1.fasta"};
+    args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/xor_"};
+    args.search_file = DATADIR"search.fasta";
+    args.solution_file = DATADIR"expected_search_result.out";
+    args.fpr = 0.0001;
+    args.xor_filters = true;
+    do_accuracy(args);
+
+    // The stored xor filters give the same result
+    std::string line;
+    std::ifstream infile{std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out"};
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    args.input_file = {std::string{args.path_out} + "minimiser_hash_19_19.xor"};
+    args.xor_filters = false;
+    do_accuracy(args);
+    infile.open(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("minimiser_hash_19_19\t2\t0\t0\t0", line);
+    infile.close();
+
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19.xor");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + ".search_out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_accuracy.out");
+    std::filesystem::remove(std::string{args.path_out} + "minimiser_hash_19_19_" + std::string{args.search_file.stem()} + "_performance.out");
+}
+
+TEST(minions, accuracy_xor_bins)
+{
+    expect_same_bins_as_ibf(&accuracy_arguments::xor_filters, "xor_bins_");
 }
 
 TEST(minions, accuracy_sequence_file)
@@ -144,7 +613,7 @@ TEST(minions, accuracy_sequence_file)
     args.path_out = std::filesystem::path{std::string{std::filesystem::temp_directory_path()} + "/fasta_"};
     args.search_file = DATADIR"search.fasta";
     args.solution_file = DATADIR"expected_search_result.out";
-    args.threshold = 0.5;
+    args.thresholds = {0.5};
     do_accuracy(args);
 
     seqan3::interleaved_bloom_filter ibf{};
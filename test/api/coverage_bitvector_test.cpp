@@ -0,0 +1,103 @@
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "coverage_bitvector.hpp"
+
+using seqan3::operator""_shape;
+using islands_t = std::vector<std::pair<uint64_t, uint64_t>>;
+
+islands_t get_islands(coverage_bitvector const & covs)
+{
+    islands_t result{};
+    covs.for_each_island([&] (uint64_t const start, uint64_t const length) { result.emplace_back(start, length); });
+    return result;
+}
+
+TEST(coverage_bitvector, empty)
+{
+    coverage_bitvector covs{0, seqan3::ungapped{4}};
+    EXPECT_EQ(0u, covs.count());
+    EXPECT_EQ(islands_t{}, get_islands(covs));
+}
+
+TEST(coverage_bitvector, uncovered)
+{
+    coverage_bitvector covs{130, seqan3::ungapped{4}};
+    EXPECT_EQ(0u, covs.count());
+    EXPECT_EQ((islands_t{{0, 130}}), get_islands(covs));
+}
+
+TEST(coverage_bitvector, ungapped)
+{
+    coverage_bitvector covs{20, seqan3::ungapped{4}};
+    covs.cover(2);
+    covs.cover(4);
+    covs.cover(16);
+    EXPECT_EQ(10u, covs.count());
+    EXPECT_EQ((islands_t{{0, 2}, {8, 8}}), get_islands(covs));
+}
+
+TEST(coverage_bitvector, gapped)
+{
+    coverage_bitvector covs{10, 0b1001_shape};
+    covs.cover(0);
+    covs.cover(6);
+    EXPECT_EQ(4u, covs.count());
+    EXPECT_EQ((islands_t{{1, 2}, {4, 2}, {7, 2}}), get_islands(covs));
+}
+
+TEST(coverage_bitvector, word_boundaries)
+{
+    coverage_bitvector covs{200, seqan3::ungapped{10}};
+    covs.cover(60);
+    covs.cover(120);
+    covs.cover(190);
+    EXPECT_EQ(30u, covs.count());
+    EXPECT_EQ((islands_t{{0, 60}, {70, 50}, {130, 60}}), get_islands(covs));
+}
+
+TEST(coverage_bitvector, random)
+{
+    std::mt19937_64 engine{7};
+    seqan3::shape const shape = 0b1101100111_shape;
+    for (size_t size : {10u, 64u, 65u, 333u, 1000u})
+    {
+        coverage_bitvector covs{size, shape};
+        std::vector<bool> expected(size, false);
+        std::uniform_int_distribution<uint64_t> distribution{0, size - shape.size()};
+        for (size_t i = 0; i < size / 15; ++i)
+        {
+            uint64_t const position = distribution(engine);
+            covs.cover(position);
+            for (size_t pos = 0; pos < shape.size(); ++pos)
+                if (shape[pos] == 1)
+                    expected[position + pos] = true;
+        }
+
+        islands_t expected_islands{};
+        uint64_t covered{};
+        uint64_t island{};
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (expected[i])
+            {
+                ++covered;
+                if (island > 0)
+                    expected_islands.emplace_back(i - island, island);
+                island = 0;
+            }
+            else
+            {
+                ++island;
+            }
+        }
+        if (island > 0)
+            expected_islands.emplace_back(size - island, island);
+
+        EXPECT_EQ(covered, covs.count());
+        EXPECT_EQ(expected_islands, get_islands(covs));
+    }
+}
@@ -0,0 +1,49 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "exact_index.hpp"
+
+TEST(exact_index, bulk_contains)
+{
+    exact_index index{{{1, 2, 3, 2}, {3, 4}, {}, {5}}};
+    EXPECT_EQ(4u, index.bin_count());
+    EXPECT_EQ(5u, index.size());
+
+    auto agent = index.membership_agent();
+    EXPECT_EQ((std::vector<uint64_t>{0b0001}), agent.bulk_contains(1).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0b0011}), agent.bulk_contains(3).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0b1000}), agent.bulk_contains(5).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0}), agent.bulk_contains(6).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0}), agent.bulk_contains(0).raw_data());
+
+    exact_index empty{{{}, {}}};
+    EXPECT_EQ((std::vector<uint64_t>{0}), empty.membership_agent().bulk_contains(1).raw_data());
+}
+
+// Compares to the bins, in which the values were inserted, there are no false positives.
+TEST(exact_index, random)
+{
+    size_t const bins{150};
+    std::mt19937_64 engine{42};
+    std::vector<std::vector<uint64_t>> values(bins);
+    std::vector<std::vector<uint64_t>> expected(30'000, std::vector<uint64_t>(3, 0));
+    for (size_t bin = 0; bin < bins; ++bin)
+    {
+        for (size_t i = 0; i < 200; ++i)
+        {
+            uint64_t const value = engine() % expected.size();
+            values[bin].push_back(value);
+            expected[value][bin / 64] |= uint64_t{1} << (bin % 64);
+        }
+    }
+
+    exact_index index{values};
+    auto agent = index.membership_agent();
+    for (uint64_t value = 0; value < expected.size() + 100; ++value)
+    {
+        std::vector<uint64_t> const none(3, 0);
+        EXPECT_EQ(value < expected.size() ? expected[value] : none, agent.bulk_contains(value).raw_data());
+    }
+}
@@ -0,0 +1,60 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "hierarchical_ibf.hpp"
+
+class hierarchical_ibf_test : public ::testing::Test
+{
+protected:
+    // One large bin, many small ones. Bin b contains the values b * 100'000 + i for i < elements[b].
+    std::vector<uint64_t> elements{20'000, 900, 800, 600, 500, 400, 300, 200, 100, 100, 50};
+
+    hierarchical_ibf build() const
+    {
+        hierarchical_ibf hibf{elements, 0.01, 8};
+        for (size_t bin = 0; bin < elements.size(); ++bin)
+            for (uint64_t i = 0; i < elements[bin]; ++i)
+                hibf.emplace(bin * 100'000 + i, bin);
+        return hibf;
+    }
+};
+
+TEST_F(hierarchical_ibf_test, layout)
+{
+    hierarchical_ibf const hibf = build();
+    EXPECT_EQ(elements.size(), hibf.bin_count());
+    EXPECT_LT(1u, hibf.split_count(0));
+    EXPECT_EQ(1u, hibf.split_count(10));
+    EXPECT_LE(1u, hibf.lower_count());
+    EXPECT_LT(hibf.technical_bin_count(), elements.size() + hibf.split_count(0));
+
+    // Much smaller than an ibf, in which every bin has the size of the largest one.
+    ibf_size const flat = optimal_ibf_size(elements[0], 0.01);
+    EXPECT_LT(hibf.bytes(), flat.bytes(elements.size()));
+}
+
+// Every bin, that contains at least threshold many values of a read, is found with its full count.
+TEST_F(hierarchical_ibf_test, bulk_count)
+{
+    hierarchical_ibf const hibf = build();
+    auto agent = hibf.membership_agent();
+    std::mt19937_64 engine{42};
+
+    for (size_t bin = 0; bin < elements.size(); ++bin)
+    {
+        std::vector<uint64_t> read{};
+        for (size_t i = 0; i < 40; ++i)
+            read.push_back(bin * 100'000 + engine() % elements[bin]);
+        // Values, that are in no bin.
+        for (size_t i = 0; i < 10; ++i)
+            read.push_back(50'000'000 + engine() % 1'000'000);
+
+        std::vector<uint64_t> const & counts = agent.bulk_count(read, 30);
+        ASSERT_EQ(elements.size(), counts.size());
+        EXPECT_LE(40u, counts[bin]);
+        for (size_t other = 0; other < elements.size(); ++other)
+            EXPECT_TRUE(other == bin || counts[other] < 30u);
+    }
+}
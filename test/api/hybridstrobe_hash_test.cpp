@@ -0,0 +1,118 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "hybridstrobe_hash.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<uint64_t>;
+
+static constexpr seqan3::shape ungapped_shape = seqan3::ungapped{4};
+static constexpr seqan3::shape gapped_shape = 0b1001_shape;
+static constexpr auto ungapped_view = hybridstrobe_hash(ungapped_shape,
+                                                        2,5,
+                                                        seqan3::seed{0});
+static constexpr auto gapped_view = hybridstrobe_hash(gapped_shape,
+                                                      2,5,
+                                                      seqan3::seed{0});
+
+template <typename T>
+class hybridstrobe_hash_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(hybridstrobe_hash_view_properties_test, underlying_range_types, );
+
+class hybridstrobe_hash_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAAAAAAAA"_dna4};
+    result_t result1{0,0,0,0,0}; // Same result for ungapped and gapped
+
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    //                          kmers: ACGG,     CGGC,     GGCG,     GCGA,     CGAC,     GACG,     ACGT, CGTT, GTTT, TTTA, TTAG
+    //                ungapped Hashes: 26,       105,      166,      152,      97,       134,      27,   111,  191,  252,  242
+    //                  gapped Hashes: 2,        5,        10,       8,        5,        10,       3,    7,    11,   12,   14
+    //         ungapped hybridstrobes: ACGGCGAC, CGGCGCGA, GGCGGACG, GCGACGTT, CGACCGTT, GACGTTTA, ACGTGTTT
+    //           gapped hybridstrobes: A--GC--C, C--CG--G, G--GG--G, G--AC--T, C--CG--T, G--GG--T, A--TG--T
+    //  stop at T ungapped hybridstrobes: ACGGCGAC, CGGCGCGA
+    // start at A ungapped hybridstrobes:                              GCGACGTT, CGACCGTT, GACGTTTA, ACGTGTTT
+    result_t result3_ungapped{6753, 27032, 42630, 39023, 24943, 34556, 7103};
+    result_t result3_gapped{517, 1290, 2570, 2055, 1291, 2571, 779};
+    result_t result3_ungapped_large{6683, 26977, 42523, 39154};
+    result_t result3_ungapped_stop{6753, 27032};
+    result_t result3_ungapped_start{39023, 24943, 34556, 7103};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(hybridstrobe_hash_view_properties_test, different_input_ranges)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t ungapped{7094, 28001, 46619, 55430, 24943, 34556, 7103};
+    result_t gapped{778, 1290, 2570, 3082, 1291, 2571, 779};
+    EXPECT_RANGE_EQ(ungapped, text | ungapped_view);
+    EXPECT_RANGE_EQ(gapped, text | gapped_view);
+}
+
+TEST_F(hybridstrobe_hash_test, ungapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | ungapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped, text3 | ungapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped_large, text3 | hybridstrobe_hash(ungapped_shape, 2,7, seqan3::seed{0}));
+    EXPECT_NO_THROW(text1 | hybridstrobe_hash(ungapped_shape, 3,6));
+    EXPECT_THROW((text3 | hybridstrobe_hash(ungapped_shape, 3,4)), std::invalid_argument);
+}
+
+TEST_F(hybridstrobe_hash_test, gapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | gapped_view);
+    EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_view);
+    EXPECT_NO_THROW(text1 | hybridstrobe_hash(gapped_shape, 2,5));
+    EXPECT_THROW((text3 | hybridstrobe_hash(gapped_shape, 1,5)), std::invalid_argument);
+}
+
+TEST_F(hybridstrobe_hash_test, seed)
+{
+    result_t seeded{45325, 49709, 3373, 13101, 51908, 11716, 45145};
+    EXPECT_RANGE_EQ(seeded, text3 | hybridstrobe_hash(ungapped_shape, 2,5, seqan3::seed{0xAB}));
+}
+
+TEST_F(hybridstrobe_hash_test, combinability)
+{
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | ungapped_view);
+
+    auto start_at_a = std::views::drop(3);
+    EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | ungapped_view);
+}
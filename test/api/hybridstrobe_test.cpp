@@ -0,0 +1,149 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../../lib/seqan3/test/unit/range/iterator_test_template.hpp"
+
+#include "hybridstrobe.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<std::vector<size_t>>;
+
+inline static constexpr auto kmer_view = seqan3::views::kmer_hash(seqan3::ungapped{4});
+inline static constexpr auto gapped_kmer_view = seqan3::views::kmer_hash(0b1001_shape);
+
+inline static constexpr auto hybridstrobe_view = seqan3::views::hybridstrobe(2,5);
+
+using iterator_type = std::ranges::iterator_t< decltype(std::declval<seqan3::dna4_vector&>()
+                                               | kmer_view
+                                               | hybridstrobe_view)>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    seqan3::dna4_vector text{"ACGGCGACGTTTAG"_dna4};
+    decltype(seqan3::views::kmer_hash(text, seqan3::ungapped{4})) vec = text | kmer_view;
+    result_t expected_range{{26,97},{105,152},{166,134},{152,111},{97,111},{134,252},{27,191}};
+
+    decltype(seqan3::views::hybridstrobe(seqan3::views::kmer_hash(text, seqan3::ungapped{4}), 2, 5)) test_range =
+    seqan3::views::hybridstrobe(vec, 2, 5);
+};
+
+using test_types = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_types, );
+
+template <typename T>
+class hybridstrobe_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+TYPED_TEST_SUITE(hybridstrobe_view_properties_test, underlying_range_types, );
+
+class hybridstrobe_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAAAAAAAA"_dna4};
+    result_t result1{{0,0},{0,0},{0,0},{0,0},{0,0}}; // Same result for ungapped and gapped
+
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    //                          kmers: ACGG,     CGGC,     GGCG,     GCGA,     CGAC,     GACG,     ACGT, CGTT, GTTT, TTTA, TTAG
+    //                ungapped Hashes: 26,       105,      166,      152,      97,       134,      27,   111,  191,  252,  242
+    //                  gapped Hashes: 2,        5,        10,       8,        5,        10,       3,    7,    11,   12,   14
+    // With window_min 2 and window_max 5 every segment consists of one value at the offsets 2, 3 and 4, the first
+    // strobe modulo 3 chooses the offset.
+    result_t result3_ungapped{{26,97},{105,152},{166,134},{152,111},{97,111},{134,252},{27,191}};
+    result_t result3_gapped{{2,5},{5,10},{10,10},{8,7},{5,11},{10,11},{3,11}};
+    // With window_max 7 the segments consist of two values at the offsets [2,3], [4,5] and [6,7].
+    result_t result3_ungapped_large{{26,27},{105,97},{166,27},{152,242}};
+    result_t result3_ungapped_stop{{26,97},{105,152}};
+    result_t result3_gapped_stop{{2,5},{5,10}};
+    result_t result3_ungapped_start{{152,111},{97,111},{134,252},{27,191}};
+    result_t result3_gapped_start{{8,7},{5,11},{10,11},{3,11}};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(hybridstrobe_view_properties_test, concepts)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                   'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+
+    auto v = text | kmer_view | hybridstrobe_view;
+    compare_types(v);
+}
+
+TYPED_TEST(hybridstrobe_view_properties_test, different_inputs_kmer_hash)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                   'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t ungapped{{27,182},{109,97},{182,27},{216,134},{97,111},{134,252},{27,191}};
+    result_t gapped{{3,10},{5,10},{10,10},{12,10},{5,11},{10,11},{3,11}};
+    EXPECT_RANGE_EQ(ungapped, text | kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(gapped, text | gapped_kmer_view | hybridstrobe_view);
+}
+
+TEST_F(hybridstrobe_test, ungapped_kmer_hash)
+{
+    EXPECT_RANGE_EQ(result1, text1 | kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(result3_ungapped, text3 | kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(result3_ungapped_large, text3 | kmer_view | seqan3::views::hybridstrobe(2,7));
+}
+
+TEST_F(hybridstrobe_test, gapped_kmer_hash)
+{
+    EXPECT_RANGE_EQ(result1, text1 | gapped_kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_kmer_view | hybridstrobe_view);
+}
+
+TEST_F(hybridstrobe_test, selection)
+{
+    // The first strobe modulo 3 chooses the segment, the second strobe is the leftmost minimum of that segment.
+    std::vector<uint64_t> hashes{28, 100, 9, 23, 4, 1, 72, 37, 8};
+    result_t expected{{28,23},{100,4},{9,4},{23,37},{4,37}};
+    EXPECT_RANGE_EQ(expected, hashes | seqan3::views::hybridstrobe(2,4));
+
+    EXPECT_THROW((hashes | seqan3::views::hybridstrobe(2,3)), std::invalid_argument);
+    EXPECT_THROW((hashes | seqan3::views::hybridstrobe(1,4)), std::invalid_argument);
+}
+
+TEST_F(hybridstrobe_test, combinability)
+{
+    auto start_at_a = std::views::drop(3);
+    EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_kmer_view | hybridstrobe_view);
+
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | kmer_view | hybridstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped_stop, text3 | stop_at_t | gapped_kmer_view | hybridstrobe_view);
+}
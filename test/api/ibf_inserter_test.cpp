@@ -0,0 +1,47 @@
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ibf_inserter.hpp"
+
+// Inserting from several threads, also into bins sharing a word, sets the same bits as emplace of the ibf.
+TEST(ibf_inserter, emplace)
+{
+    for (size_t bins : {1, 64, 130})
+    {
+        seqan3::interleaved_bloom_filter expected{seqan3::bin_count{bins},
+                                                  seqan3::bin_size{1000u},
+                                                  seqan3::hash_function_count{3u}};
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins},
+                                             seqan3::bin_size{1000u},
+                                             seqan3::hash_function_count{3u}};
+        std::mt19937_64 engine{bins};
+        std::vector<std::pair<uint64_t, size_t>> values{};
+        for (size_t i = 0; i < 20000; ++i)
+        {
+            values.emplace_back(engine(), engine() % bins);
+            expected.emplace(values.back().first, seqan3::bin_index{values.back().second});
+        }
+
+        ibf_inserter const inserter{ibf};
+        std::vector<std::thread> threads{};
+        for (size_t thread = 0; thread < 4; ++thread)
+        {
+            threads.emplace_back([&, thread] ()
+            {
+                for (size_t i = thread; i < values.size(); i += 4)
+                    inserter.emplace(values[i].first, seqan3::bin_index{values[i].second});
+            });
+        }
+        for (auto & thread : threads)
+            thread.join();
+
+        size_t const words = (bins + 63) / 64 * 1000;
+        uint64_t const * const result = ibf.raw_data().data();
+        uint64_t const * const expected_words = expected.raw_data().data();
+        for (size_t w = 0; w < words; ++w)
+            ASSERT_EQ(expected_words[w], result[w]);
+    }
+}
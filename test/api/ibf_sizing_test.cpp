@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "ibf_sizing.hpp"
+
+TEST(ibf_sizing, false_positive_rate)
+{
+    EXPECT_EQ(1.0, false_positive_rate(0, 1, 10));
+    EXPECT_EQ(0.0, false_positive_rate(100, 1, 0));
+    EXPECT_NEAR(1 - std::exp(-0.5), false_positive_rate(2000, 1, 1000), 1e-12);
+}
+
+TEST(ibf_sizing, optimal_ibf_size)
+{
+    for (double fpr : {0.3, 0.05, 0.01, 0.001})
+    {
+        ibf_size const size = optimal_ibf_size(1'000'000, fpr);
+        EXPECT_LE(false_positive_rate(size.bin_size, size.hash_count, 1'000'000), fpr);
+        // One bit less is not enough for any hash count.
+        for (size_t hash_count = 1; hash_count <= 5; ++hash_count)
+            EXPECT_GT(false_positive_rate(size.bin_size - 1, hash_count, 1'000'000), fpr);
+    }
+
+    // For 5 % about 6.2 bits per value and 4 hash functions are optimal.
+    ibf_size const size = optimal_ibf_size(1'000'000, 0.05);
+    EXPECT_EQ(4u, size.hash_count);
+    EXPECT_NEAR(6.24, size.bin_size / 1e6, 0.01);
+    EXPECT_EQ(2 * 8 * size.bin_size, size.bytes(65));
+
+    // Only one hash function is allowed.
+    EXPECT_EQ(1u, optimal_ibf_size(1000, 0.05, 1).hash_count);
+    EXPECT_LT(0u, optimal_ibf_size(0, 0.05).bin_size);
+}
+
+TEST(ibf_sizing, optimal_blocked_size)
+{
+    EXPECT_EQ(1.0, blocked_false_positive_rate(7, 1, 10));
+    EXPECT_EQ(0.0, blocked_false_positive_rate(800, 1, 0));
+    // With one value per block on average and one hash function, a bit is 0 with probability e^(-1/8).
+    EXPECT_NEAR(1 - std::exp(-1.0 / 8), blocked_false_positive_rate(8000, 1, 1000), 1e-9);
+
+    for (double fpr : {0.3, 0.05, 0.01})
+    {
+        ibf_size const size = optimal_blocked_size(1'000'000, fpr);
+        EXPECT_EQ(0u, size.bin_size % 8);
+        EXPECT_LE(blocked_false_positive_rate(size.bin_size, size.hash_count, 1'000'000), fpr);
+        EXPECT_GT(blocked_false_positive_rate(size.bin_size - 8, size.hash_count, 1'000'000), fpr);
+        // The blocks need more bits than the ibf.
+        EXPECT_LT(optimal_ibf_size(1'000'000, fpr).bin_size, size.bin_size);
+    }
+}
@@ -0,0 +1,78 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mapped_ibf.hpp"
+
+class mapped_ibf_test : public ::testing::Test
+{
+protected:
+    std::filesystem::path const path{std::string{std::filesystem::temp_directory_path()} + "/mapped_ibf_test.ibf"};
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+// The mapped ibf gives the same results as the ibf it was stored from.
+TEST_F(mapped_ibf_test, bulk_contains)
+{
+    for (size_t hash_count : {1, 2, 3, 5})
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{130u},
+                                             seqan3::bin_size{1000u},
+                                             seqan3::hash_function_count{hash_count}};
+        std::mt19937_64 engine{hash_count};
+        for (size_t i = 0; i < 2000; ++i)
+            ibf.emplace(engine() % 5000, seqan3::bin_index{engine() % 130});
+
+        mapped_ibf_header header{};
+        header.k_size = 19;
+        header.w_size = 19;
+        std::string const method{"minimiser_hash_19_19"};
+        std::copy(method.begin(), method.end(), header.method.begin());
+        store_mapped_ibf(ibf, path, header);
+        EXPECT_TRUE(is_mapped_ibf(path));
+
+        mapped_ibf mapped{path};
+        EXPECT_EQ(130u, mapped.bin_count());
+        EXPECT_EQ(1000u, mapped.bin_size());
+        EXPECT_EQ(hash_count, mapped.hash_function_count());
+        EXPECT_EQ(19u, mapped.header().k_size);
+        EXPECT_EQ(method, std::string{mapped.header().method.data()});
+
+        // Copying back gives the same ibf.
+        auto copy = mapped.to_ibf();
+
+        auto agent = ibf.membership_agent();
+        auto copy_agent = copy.membership_agent();
+        auto mapped_agent = mapped.membership_agent();
+        for (uint64_t value = 0; value < 5000; ++value)
+        {
+            uint64_t const * expected = agent.bulk_contains(value).raw_data().data();
+            uint64_t const * copied = copy_agent.bulk_contains(value).raw_data().data();
+            std::vector<uint64_t> const & result = mapped_agent.bulk_contains(value).raw_data();
+            ASSERT_EQ(3u, result.size());
+            for (size_t word = 0; word < result.size(); ++word)
+            {
+                EXPECT_EQ(expected[word], result[word]);
+                EXPECT_EQ(expected[word], copied[word]);
+            }
+        }
+    }
+}
+
+TEST_F(mapped_ibf_test, no_ibf_file)
+{
+    {
+        std::ofstream os{path};
+        os << "This is no ibf file, but it is long enough to contain a header, if it was one. "
+              "This is no ibf file, but it is long enough to contain a header, if it was one.";
+    }
+    EXPECT_FALSE(is_mapped_ibf(path));
+    EXPECT_THROW(mapped_ibf{path}, std::runtime_error);
+    EXPECT_THROW(mapped_ibf{path.string() + ".missing"}, std::runtime_error);
+}
@@ -0,0 +1,47 @@
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "minimal_perfect_hash.hpp"
+
+// Every key gets another number less than the number of keys.
+TEST(minimal_perfect_hash, minimal_and_perfect)
+{
+    std::mt19937_64 engine{42};
+    for (size_t n : {0, 1, 2, 100, 100'000})
+    {
+        std::unordered_set<uint64_t> unique{};
+        while (unique.size() < n)
+            unique.insert(engine());
+        std::vector<uint64_t> const keys(unique.begin(), unique.end());
+
+        for (double gamma : {1.0, 2.0})
+        {
+            minimal_perfect_hash hash{keys, gamma};
+            EXPECT_EQ(n, hash.size());
+            std::vector<bool> used(n, false);
+            for (uint64_t const key : keys)
+            {
+                uint64_t const number = hash(key);
+                ASSERT_LT(number, n);
+                EXPECT_FALSE(used[number]);
+                used[number] = true;
+            }
+            // Other values get any number, 0 without keys.
+            for (size_t i = 0; i < 100; ++i)
+                EXPECT_LT(hash(engine()), std::max<size_t>(n, 1));
+        }
+    }
+}
+
+TEST(minimal_perfect_hash, memory)
+{
+    std::vector<uint64_t> keys(1'000'000);
+    for (size_t i = 0; i < keys.size(); ++i)
+        keys[i] = i * 7;
+    minimal_perfect_hash hash{keys};
+    // About 3 bits per key and the ranks.
+    EXPECT_GT(5.0, 8.0 * hash.bytes() / keys.size());
+}
@@ -0,0 +1,137 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../../lib/seqan3/test/unit/range/iterator_test_template.hpp"
+
+
+#include "minstrobe_hash_position.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<std::pair<uint64_t, uint64_t>>;
+
+using iterator_type = std::ranges::iterator_t<decltype(std::declval<seqan3::dna4_vector&>()
+                                                       | minstrobe_hash_position(seqan3::ungapped{4},
+                                                                                 2,
+                                                                                 5,
+                                                                                 seqan3::seed{0}))>;
+
+static constexpr seqan3::shape ungapped_shape = seqan3::ungapped{4};
+static constexpr seqan3::shape gapped_shape = 0b1001_shape;
+static constexpr auto ungapped_view = minstrobe_hash_position(ungapped_shape, 2, 5, seqan3::seed{0});
+static constexpr auto gapped_view = minstrobe_hash_position(gapped_shape, 2, 5, seqan3::seed{0});
+static constexpr auto ungapped_view3 = minstrobe3_hash_position(ungapped_shape, 2, 3, seqan3::seed{0});
+static constexpr auto gapped_view3 = minstrobe3_hash_position(gapped_shape, 2, 3, seqan3::seed{0});
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = false;
+
+    seqan3::dna4_vector text{"ACGGCGACGTTTAG"_dna4};
+    result_t expected_range{{6753, 0}, {26907, 1}, {42523, 2}, {38939, 3}, {24859, 4}, {34415, 5}};
+
+    using test_range_t = decltype(text | ungapped_view);
+    test_range_t test_range = text | ungapped_view;
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+template <typename T>
+class minstrobe_hash_position_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(minstrobe_hash_position_view_properties_test, underlying_range_types, );
+
+class minstrobe_hash_position_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAAAAAAAA"_dna4};
+    result_t result1{{0, 0}, {0, 1}, {0, 2}, {0, 3}}; // Same result for ungapped and gapped
+    result_t result1_order3{{0, 0}, {0, 1}, {0, 2}};
+
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    result_t result3_ungapped{{6753, 0}, {26907, 1}, {42523, 2}, {38939, 3}, {24859, 4}, {34415, 5}};
+    result_t result3_gapped{{517, 0}, {1283, 1}, {2563, 2}, {2051, 3}, {1283, 4}, {2567, 5}};
+    result_t result3_ungapped_stop{{6753, 0}};
+    result_t result3_gapped_stop{{517, 0}};
+    result_t result3_ungapped_start{{38939, 0}, {24859, 1}, {34415, 2}};
+    result_t result3_gapped_start{{2051, 0}, {1283, 1}, {2567, 2}};
+    result_t result3_ungapped_order3{{8282973779022311854u, 0}, {212784940867866007u, 1}, {3447775768544533484u, 2},
+                                     {3604925949990352227u, 3}, {1382049247437808939u, 4}};
+    result_t result3_gapped_order3{{17912494212002788996u, 0}, {17502842644965234667u, 1}, {12372743993845366729u, 2},
+                                   {6480221179595142874u, 3}, {82156967920554176u, 4}};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(minstrobe_hash_position_view_properties_test, different_input_ranges)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t ungapped{{7009, 0}, {27931, 1}, {46619, 2}, {55323, 3}, {24859, 4}, {34415, 5}};
+    // The minstrobes at the positions 1 and 4 share their hash value.
+    result_t gapped{{773, 0}, {1283, 1}, {2563, 2}, {3075, 3}, {1283, 4}, {2567, 5}};
+    EXPECT_RANGE_EQ(ungapped, text | ungapped_view);
+    EXPECT_RANGE_EQ(gapped, text | gapped_view);
+}
+
+TEST_F(minstrobe_hash_position_test, ungapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | ungapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped, text3 | ungapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | ungapped_view3);
+    EXPECT_RANGE_EQ(result3_ungapped_order3, text3 | ungapped_view3);
+}
+
+TEST_F(minstrobe_hash_position_test, gapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | gapped_view);
+    EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | gapped_view3);
+    EXPECT_RANGE_EQ(result3_gapped_order3, text3 | gapped_view3);
+    EXPECT_THROW((text3 | minstrobe_hash_position(gapped_shape, 2, 1)), std::invalid_argument);
+}
+
+TEST_F(minstrobe_hash_position_test, combinability)
+{
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | ungapped_view);
+    EXPECT_RANGE_EQ(result3_gapped_stop, text3 | stop_at_t | gapped_view);
+
+    auto start_at_a = std::views::drop(3);
+    EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | ungapped_view);
+    EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_view);
+}
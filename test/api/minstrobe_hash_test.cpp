@@ -34,6 +34,12 @@ static constexpr auto ungapped_view = minstrobe_hash(ungapped_shape,
 static constexpr auto gapped_view = minstrobe_hash(gapped_shape,
                                                    2,5,
                                                    seqan3::seed{0});
+static constexpr auto ungapped_view3 = minstrobe3_hash(ungapped_shape,
+                                                       2,3,
+                                                       seqan3::seed{0});
+static constexpr auto gapped_view3 = minstrobe3_hash(gapped_shape,
+                                                     2,3,
+                                                     seqan3::seed{0});
 
 /*template <>
 struct iterator_fixture<iterator_type> : public ::testing::Test
@@ -84,6 +90,13 @@ protected:
     result_t result3_gapped_stop{517};
     result_t result3_ungapped_start{38939, 24859, 34415};
     result_t result3_gapped_start{2051, 1283, 2567};
+    // Order 3 with window_min 2 and window_max 3.
+    result_t result1_order3{0,0,0};
+    result_t result3_ungapped_order3{8282973779022311854u, 212784940867866007u, 3447775768544533484u,
+                                     3604925949990352227u, 1382049247437808939u};
+    result_t result3_gapped_order3{17912494212002788996u, 17502842644965234667u, 12372743993845366729u,
+                                   6480221179595142874u, 82156967920554176u};
+    result_t result3_ungapped_start_order3{3604925949990352227u, 1382049247437808939u};
 };
 
 template <typename adaptor_t>
@@ -106,14 +119,22 @@ TYPED_TEST(minstrobe_hash_view_properties_test, different_input_ranges)
                 'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
     result_t ungapped{7009, 27931, 46619, 55323, 24859, 34415};
     result_t gapped{773, 1283, 2563, 3075, 1283, 2567};
+    result_t ungapped_order3{7817110113233604118u, 5113704171376078250u, 10631216490116434274u, 13497498461087149963u,
+                             1382049247437808939u};
+    result_t gapped_order3{17219570877459419379u, 17502842644965234667u, 12372743993845366729u, 16393536862361226309u,
+                           82156967920554176u};
     EXPECT_RANGE_EQ(ungapped, text | ungapped_view);
     EXPECT_RANGE_EQ(gapped, text | gapped_view);
+    EXPECT_RANGE_EQ(ungapped_order3, text | ungapped_view3);
+    EXPECT_RANGE_EQ(gapped_order3, text | gapped_view3);
 }
 
 TEST_F(minstrobe_hash_test, ungapped)
 {
     EXPECT_RANGE_EQ(result1, text1 | ungapped_view);
     EXPECT_RANGE_EQ(result3_ungapped, text3 | ungapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | ungapped_view3);
+    EXPECT_RANGE_EQ(result3_ungapped_order3, text3 | ungapped_view3);
     EXPECT_NO_THROW(text1 | minstrobe_hash(ungapped_shape, 3,6));
     EXPECT_THROW((text3 | minstrobe_hash(ungapped_shape, 3,2)), std::invalid_argument);
 }
@@ -122,8 +143,34 @@ TEST_F(minstrobe_hash_test, gapped)
 {
     EXPECT_RANGE_EQ(result1, text1 | gapped_view);
     EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | gapped_view3);
+    EXPECT_RANGE_EQ(result3_gapped_order3, text3 | gapped_view3);
     EXPECT_NO_THROW(text1 | minstrobe_hash(gapped_shape, 2,5));
     EXPECT_THROW((text3 | minstrobe_hash(gapped_shape, 2,1)), std::invalid_argument);
+    EXPECT_THROW((text3 | minstrobe3_hash(gapped_shape, 2,1)), std::invalid_argument);
+}
+
+TEST_F(minstrobe_hash_test, order3_first_strobe)
+{
+    // For k = 19, 4^(2k) is a multiple of 2^64. The first base is only part of the first strobe of the first minstrobe
+    // and changes its highest bits, nevertheless it must change the hash.
+    auto view = minstrobe3_hash(seqan3::ungapped{19}, 2, 5, seqan3::seed{0});
+    std::vector<seqan3::dna4> text{"ACGGCGACGTTTAGGCATGCAACGTTAGCAT"_dna4};
+    std::vector<seqan3::dna4> changed{text};
+    changed[0] = 'T'_dna4;
+
+    result_t hashes{};
+    for (uint64_t const hash : text | view)
+        hashes.push_back(hash);
+    result_t changed_hashes{};
+    for (uint64_t const hash : changed | view)
+        changed_hashes.push_back(hash);
+
+    ASSERT_EQ(3u, hashes.size());
+    ASSERT_EQ(3u, changed_hashes.size());
+    EXPECT_NE(hashes[0], changed_hashes[0]);
+    EXPECT_EQ(hashes[1], changed_hashes[1]);
+    EXPECT_EQ(hashes[2], changed_hashes[2]);
 }
 
 TEST_F(minstrobe_hash_test, combinability)
@@ -135,4 +182,5 @@ TEST_F(minstrobe_hash_test, combinability)
     auto start_at_a = std::views::drop(3);
     EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | ungapped_view);
     EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped_start_order3, text3 | start_at_a | ungapped_view3);
 }
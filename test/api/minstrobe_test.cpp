@@ -19,12 +19,13 @@
 
 using seqan3::operator""_dna4;
 using seqan3::operator""_shape;
-using result_t = std::vector<std::vector<size_t>>;
+using result_t = std::vector<std::array<size_t, 2>>;
 
 inline static constexpr auto kmer_view = seqan3::views::kmer_hash(seqan3::ungapped{4});
 inline static constexpr auto gapped_kmer_view = seqan3::views::kmer_hash(0b1001_shape);
 
 inline static constexpr auto minstrobe_view = seqan3::views::minstrobe(2,5);
+inline static constexpr auto minstrobe3_view = seqan3::views::minstrobe3(2,3);
 
 using iterator_type = std::ranges::iterator_t< decltype(std::declval<seqan3::dna4_vector&>()
                                                | kmer_view
@@ -80,6 +81,14 @@ protected:
     result_t result3_gapped_stop{{2,5}};
     result_t result3_ungapped_start{{152,27},{97,27},{134,111}};
     result_t result3_gapped_start{{8,3},{5,3},{10,7}};
+
+    // Order 3 with window_min 2 and window_max 3: the windows have the offsets [2,3] and [5,6].
+    //            ungapped minstrobes: ACGGGCGAACGT, CGGCCGACACGT, GGCGCGACCGTT, GCGAACGTGTTT, CGACACGTTTAG
+    std::vector<std::array<size_t, 3>> result1_order3{{0,0,0},{0,0,0},{0,0,0}};
+    std::vector<std::array<size_t, 3>> result3_ungapped_order3{{26,152,27},{105,97,27},{166,97,111},{152,27,191},
+                                                               {97,27,242}};
+    std::vector<std::array<size_t, 3>> result3_gapped_order3{{2,8,3},{5,5,3},{10,5,7},{8,3,11},{5,3,12}};
+    std::vector<std::array<size_t, 3>> result3_ungapped_start_order3{{152,27,191},{97,27,242}};
 };
 
 template <typename adaptor_t>
@@ -103,6 +112,8 @@ TYPED_TEST(minstrobe_view_properties_test, concepts)
 
     auto v = text | kmer_view | minstrobe_view;
     compare_types(v);
+    auto v3 = text | kmer_view | minstrobe3_view;
+    compare_types(v3);
 }
 
 TYPED_TEST(minstrobe_view_properties_test, different_inputs_kmer_hash)
@@ -119,12 +130,26 @@ TEST_F(minstrobe_test, ungapped_kmer_hash)
 {
     EXPECT_RANGE_EQ(result1, text1 | kmer_view | minstrobe_view);
     EXPECT_RANGE_EQ(result3_ungapped, text3 | kmer_view | minstrobe_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | kmer_view | minstrobe3_view);
+    EXPECT_RANGE_EQ(result3_ungapped_order3, text3 | kmer_view | minstrobe3_view);
 }
 
 TEST_F(minstrobe_test, gapped_kmer_hash)
 {
     EXPECT_RANGE_EQ(result1, text1 | gapped_kmer_view | minstrobe_view);
     EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_kmer_view | minstrobe_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | gapped_kmer_view | minstrobe3_view);
+    EXPECT_RANGE_EQ(result3_gapped_order3, text3 | gapped_kmer_view | minstrobe3_view);
+}
+
+TEST_F(minstrobe_test, order3)
+{
+    std::vector<uint64_t> hashes{6, 26, 41, 38, 24, 33, 6, 27, 47};
+    std::vector<std::array<size_t, 3>> expected{{6,38,6},{26,24,6},{41,24,27}};
+    EXPECT_RANGE_EQ(expected, hashes | seqan3::views::minstrobe3(2,3));
+
+    // Too short for a single minstrobe of order 3.
+    EXPECT_TRUE(std::ranges::empty(hashes | seqan3::views::minstrobe3(3,5)));
 }
 
 TEST_F(minstrobe_test, combinability)
@@ -132,6 +157,7 @@ TEST_F(minstrobe_test, combinability)
     auto start_at_a = std::views::drop(3);
     EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | kmer_view | minstrobe_view);
     EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_kmer_view | minstrobe_view);
+    EXPECT_RANGE_EQ(result3_ungapped_start_order3, text3 | start_at_a | kmer_view | minstrobe3_view);
 
     auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
     EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | kmer_view | minstrobe_view);
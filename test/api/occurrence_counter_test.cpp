@@ -0,0 +1,46 @@
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "occurrence_counter.hpp"
+
+TEST(occurrence_counter, count)
+{
+    occurrence_counter counter{};
+    counter.count({5, 0, 5, 7, 0, 5});
+    EXPECT_EQ((std::vector<uint64_t>{5, 0, 7}), counter.values());
+    EXPECT_EQ((std::vector<uint64_t>{3, 2, 1}), counter.counts());
+
+    counter.count({});
+    EXPECT_TRUE(counter.values().empty());
+    EXPECT_TRUE(counter.counts().empty());
+}
+
+// Compares to a std::unordered_map for reads with many repeated values.
+TEST(occurrence_counter, random)
+{
+    occurrence_counter counter{};
+    std::mt19937_64 engine{42};
+    for (size_t length : {1, 15, 100, 1000, 20000})
+    {
+        std::vector<uint64_t> values{};
+        std::unordered_map<uint64_t, uint64_t> expected{};
+        for (size_t i = 0; i < length; ++i)
+        {
+            values.push_back(engine() % (length / 4 + 1));
+            ++expected[values.back()];
+        }
+
+        counter.count(values);
+        ASSERT_EQ(expected.size(), counter.values().size());
+        uint64_t total{};
+        for (size_t i = 0; i < counter.values().size(); ++i)
+        {
+            EXPECT_EQ(expected[counter.values()[i]], counter.counts()[i]);
+            total += counter.counts()[i];
+        }
+        EXPECT_EQ(length, total);
+    }
+}
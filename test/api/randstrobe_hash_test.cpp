@@ -0,0 +1,156 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "randstrobe_hash.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<uint64_t>;
+
+static constexpr seqan3::shape ungapped_shape = seqan3::ungapped{4};
+static constexpr seqan3::shape gapped_shape = 0b1001_shape;
+static constexpr auto ungapped_view = randstrobe_hash<2>(ungapped_shape,
+                                                         2,5,
+                                                         seqan3::seed{0});
+static constexpr auto gapped_view = randstrobe_hash<2>(gapped_shape,
+                                                       2,5,
+                                                       seqan3::seed{0});
+static constexpr auto ungapped_view3 = randstrobe_hash<3>(ungapped_shape,
+                                                          2,3,
+                                                          seqan3::seed{0});
+static constexpr auto gapped_view3 = randstrobe_hash<3>(gapped_shape,
+                                                        2,3,
+                                                        seqan3::seed{0});
+
+template <typename T>
+class randstrobe_hash_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(randstrobe_hash_view_properties_test, underlying_range_types, );
+
+class randstrobe_hash_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAAAAAAAA"_dna4};
+    result_t result1{0,0,0,0}; // Same result for ungapped and gapped
+    result_t result1_order3{0,0,0};
+
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    //                          kmers: ACGG,     CGGC,     GGCG,     GCGA,     CGAC,     GACG,     ACGT, CGTT, GTTT, TTTA, TTAG
+    //                ungapped Hashes: 26,       105,      166,      152,      97,       134,      27,   111,  191,  252,  242
+    //                  gapped Hashes: 2,        5,        10,       8,        5,        10,       3,    7,    11,   12,   14
+    //           ungapped randstrobes: ACGGCGAC, CGGCACGT, GGCGACGT, GCGAACGT, CGACACGT, GACGCGTT
+    //             gapped randstrobes: A--GC--C, C--CA--T, G--GA--T, G--AA--T, C--CA--T, G--GC--T
+    //  ungapped order 3 randstrobes: ACGGGCGAACGT, CGGCCGACACGT, GGCGCGACCGTT, GCGAACGTGTTT, CGACACGTTTAG
+    result_t result3_ungapped{6753, 26907, 42523, 38939, 24859, 34415};
+    result_t result3_gapped{517, 1283, 2563, 2051, 1283, 2567};
+    result_t result3_ungapped_order3{8282973779022311854u, 212784940867866007u, 3447775768544533484u,
+                                     3604925949990352227u, 1382049247437808939u};
+    result_t result3_gapped_order3{17912494212002788996u, 17502842644965234667u, 12372743993845366729u,
+                                   6480221179595142874u, 82156967920554176u};
+    result_t result3_ungapped_stop{6753};
+    result_t result3_gapped_stop{517};
+    result_t result3_ungapped_start{38939, 24859, 34415};
+    result_t result3_gapped_start{2051, 1283, 2567};
+    result_t result3_ungapped_start_order3{3604925949990352227u, 1382049247437808939u};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(randstrobe_hash_view_properties_test, different_input_ranges)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t ungapped{7009, 27931, 46619, 55323, 24859, 34415};
+    result_t gapped{773, 1283, 2563, 3075, 1283, 2567};
+    result_t ungapped_order3{7817110113233604118u, 5113704171376078250u, 10631216490116434274u, 13497498461087149963u,
+                             1382049247437808939u};
+    EXPECT_RANGE_EQ(ungapped, text | ungapped_view);
+    EXPECT_RANGE_EQ(gapped, text | gapped_view);
+    EXPECT_RANGE_EQ(ungapped_order3, text | ungapped_view3);
+}
+
+TEST_F(randstrobe_hash_test, ungapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | ungapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped, text3 | ungapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | ungapped_view3);
+    EXPECT_RANGE_EQ(result3_ungapped_order3, text3 | ungapped_view3);
+    EXPECT_NO_THROW(text1 | randstrobe_hash<2>(ungapped_shape, 3,6));
+    EXPECT_THROW((text3 | randstrobe_hash<2>(ungapped_shape, 3,2)), std::invalid_argument);
+    EXPECT_THROW((text3 | randstrobe_hash<2>(ungapped_shape, 3,3)), std::invalid_argument);
+}
+
+TEST_F(randstrobe_hash_test, gapped)
+{
+    EXPECT_RANGE_EQ(result1, text1 | gapped_view);
+    EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | gapped_view3);
+    EXPECT_RANGE_EQ(result3_gapped_order3, text3 | gapped_view3);
+    EXPECT_NO_THROW(text1 | randstrobe_hash<3>(gapped_shape, 2,5));
+    EXPECT_THROW((text3 | randstrobe_hash<3>(gapped_shape, 2,1)), std::invalid_argument);
+}
+
+TEST_F(randstrobe_hash_test, combine_strobes)
+{
+    // Two strobes are combined as first * 4^k + second.
+    EXPECT_EQ(26u * 256u + 152u, combine_strobes(strobe_multiplicator(4), std::array<uint64_t, 2>{26, 152}));
+    EXPECT_EQ(0u, strobe_multiplicator(32));
+
+    // For k = 19, 4^(2k) is a multiple of 2^64, nevertheless the first of three strobes changes the hash.
+    uint64_t const multiplicator = strobe_multiplicator(19);
+    std::array<uint64_t, 3> strobes{uint64_t{1} << 37, 5, 7};
+    uint64_t const hash = combine_strobes(multiplicator, strobes);
+    strobes[0] = 0;
+    EXPECT_NE(hash, combine_strobes(multiplicator, strobes));
+    strobes[0] = 1;
+    EXPECT_NE(hash, combine_strobes(multiplicator, strobes));
+}
+
+TEST_F(randstrobe_hash_test, seed)
+{
+    result_t seeded{45325, 49709, 3373, 13076, 51732, 11540};
+    EXPECT_RANGE_EQ(seeded, text3 | randstrobe_hash<2>(ungapped_shape, 2,5, seqan3::seed{0xAB}));
+}
+
+TEST_F(randstrobe_hash_test, combinability)
+{
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | ungapped_view);
+    EXPECT_RANGE_EQ(result3_gapped_stop, text3 | stop_at_t | gapped_view);
+
+    auto start_at_a = std::views::drop(3);
+    EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | ungapped_view);
+    EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_view);
+    EXPECT_RANGE_EQ(result3_ungapped_start_order3, text3 | start_at_a | ungapped_view3);
+}
@@ -0,0 +1,156 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../../lib/seqan3/test/unit/range/iterator_test_template.hpp"
+
+#include "randstrobe.hpp"
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<std::vector<size_t>>;
+
+inline static constexpr auto kmer_view = seqan3::views::kmer_hash(seqan3::ungapped{4});
+inline static constexpr auto gapped_kmer_view = seqan3::views::kmer_hash(0b1001_shape);
+
+inline static constexpr auto randstrobe_view = seqan3::views::randstrobe<2>(2,5);
+inline static constexpr auto randstrobe3_view = seqan3::views::randstrobe<3>(2,3);
+
+using iterator_type = std::ranges::iterator_t< decltype(std::declval<seqan3::dna4_vector&>()
+                                               | kmer_view
+                                               | randstrobe_view)>;
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = true;
+
+    seqan3::dna4_vector text{"ACGGCGACGTTTAG"_dna4};
+    decltype(seqan3::views::kmer_hash(text, seqan3::ungapped{4})) vec = text | kmer_view;
+    result_t expected_range{{26,97},{105,27},{166,27},{152,27},{97,27},{134,111}};
+
+    decltype(seqan3::views::randstrobe<2>(seqan3::views::kmer_hash(text, seqan3::ungapped{4}), 2, 5)) test_range =
+    seqan3::views::randstrobe<2>(vec, 2, 5);
+};
+
+using test_types = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_types, );
+
+template <typename T>
+class randstrobe_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+TYPED_TEST_SUITE(randstrobe_view_properties_test, underlying_range_types, );
+
+class randstrobe_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAAAAAAAA"_dna4};
+    result_t result1{{0,0},{0,0},{0,0},{0,0}}; // Same result for ungapped and gapped
+    result_t result1_order3{{0,0,0},{0,0,0},{0,0,0}};
+
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    //                          kmers: ACGG,     CGGC,     GGCG,     GCGA,     CGAC,     GACG,     ACGT, CGTT, GTTT, TTTA, TTAG
+    //                ungapped Hashes: 26,       105,      166,      152,      97,       134,      27,   111,  191,  252,  242
+    //                  gapped Hashes: 2,        5,        10,       8,        5,        10,       3,    7,    11,   12,   14
+    // For hash values this small, the randstrobe selection (x + y) & 0xFFFF is minimised by the smallest candidate.
+    result_t result3_ungapped{{26,97},{105,27},{166,27},{152,27},{97,27},{134,111}};
+    result_t result3_gapped{{2,5},{5,3},{10,3},{8,3},{5,3},{10,7}};
+    result_t result3_ungapped_order3{{26,152,27},{105,97,27},{166,97,111},{152,27,191},{97,27,242}};
+    result_t result3_gapped_order3{{2,8,3},{5,5,3},{10,5,7},{8,3,11},{5,3,12}};
+    result_t result3_ungapped_stop{{26,97}};
+    result_t result3_gapped_stop{{2,5}};
+    result_t result3_ungapped_start{{152,27},{97,27},{134,111}};
+    result_t result3_gapped_start{{8,3},{5,3},{10,7}};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(randstrobe_view_properties_test, concepts)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                   'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+
+    auto v = text | kmer_view | randstrobe_view;
+    compare_types(v);
+    auto v3 = text | kmer_view | randstrobe3_view;
+    compare_types(v3);
+}
+
+TYPED_TEST(randstrobe_view_properties_test, different_inputs_kmer_hash)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                   'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t ungapped{{27,97},{109,27},{182,27},{216,27},{97,27},{134,111}};
+    result_t gapped{{3,5},{5,3},{10,3},{12,3},{5,3},{10,7}};
+    EXPECT_RANGE_EQ(ungapped, text | kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(gapped, text | gapped_kmer_view | randstrobe_view);
+}
+
+TEST_F(randstrobe_test, ungapped_kmer_hash)
+{
+    EXPECT_RANGE_EQ(result1, text1 | kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result3_ungapped, text3 | kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | kmer_view | randstrobe3_view);
+    EXPECT_RANGE_EQ(result3_ungapped_order3, text3 | kmer_view | randstrobe3_view);
+}
+
+TEST_F(randstrobe_test, gapped_kmer_hash)
+{
+    EXPECT_RANGE_EQ(result1, text1 | gapped_kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped, text3 | gapped_kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result1_order3, text1 | gapped_kmer_view | randstrobe3_view);
+    EXPECT_RANGE_EQ(result3_gapped_order3, text3 | gapped_kmer_view | randstrobe3_view);
+}
+
+TEST_F(randstrobe_test, selection)
+{
+    // The second strobe minimises (first + candidate) & 0xFFFF, so a large first strobe favours large candidates.
+    std::vector<uint64_t> hashes{60000, 26, 41, 65510, 24, 33, 6, 27, 47};
+    result_t expected{{60000,65510},{26,6},{41,6},{65510,27}};
+    EXPECT_RANGE_EQ(expected, hashes | seqan3::views::randstrobe<2>(3,5));
+
+    EXPECT_THROW((hashes | seqan3::views::randstrobe<2>(5,5)), std::invalid_argument);
+    EXPECT_THROW((hashes | seqan3::views::randstrobe<2>(1,5)), std::invalid_argument);
+}
+
+TEST_F(randstrobe_test, combinability)
+{
+    auto start_at_a = std::views::drop(3);
+    EXPECT_RANGE_EQ(result3_ungapped_start, text3 | start_at_a | kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped_start, text3 | start_at_a | gapped_kmer_view | randstrobe_view);
+
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_ungapped_stop, text3 | stop_at_t | kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result3_gapped_stop, text3 | stop_at_t | gapped_kmer_view | randstrobe_view);
+    EXPECT_RANGE_EQ(result_t{}, text3 | stop_at_t | kmer_view | randstrobe3_view);
+}
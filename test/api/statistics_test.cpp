@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "statistics.hpp"
+
+static std::vector<double> const values{5, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+TEST(welford_accumulator, empty)
+{
+    welford_accumulator acc{};
+    EXPECT_EQ(0u, acc.count());
+    EXPECT_EQ(0.0, acc.mean());
+    EXPECT_EQ(0.0, acc.variance());
+    EXPECT_EQ(0.0, acc.min());
+    EXPECT_EQ(0.0, acc.max());
+}
+
+TEST(welford_accumulator, push)
+{
+    welford_accumulator acc{};
+    double sum{};
+    for (double value : values)
+    {
+        acc.push(value);
+        sum += value;
+    }
+    double const mean = sum / values.size();
+    double variance{};
+    for (double value : values)
+        variance += (value - mean) * (value - mean);
+    variance /= values.size();
+
+    EXPECT_EQ(values.size(), acc.count());
+    EXPECT_NEAR(mean, acc.mean(), 1e-12);
+    EXPECT_NEAR(variance, acc.variance(), 1e-12);
+    EXPECT_NEAR(std::sqrt(variance), acc.stdev(), 1e-12);
+    EXPECT_EQ(1.0, acc.min());
+    EXPECT_EQ(9.0, acc.max());
+}
+
+TEST(welford_accumulator, merge)
+{
+    welford_accumulator all{};
+    welford_accumulator left{};
+    welford_accumulator right{};
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        all.push(values[i]);
+        (i < 4 ? left : right).push(values[i]);
+    }
+    left.merge(right);
+    left.merge(welford_accumulator{});
+
+    EXPECT_EQ(all.count(), left.count());
+    EXPECT_NEAR(all.mean(), left.mean(), 1e-12);
+    EXPECT_NEAR(all.variance(), left.variance(), 1e-12);
+    EXPECT_EQ(all.min(), left.min());
+    EXPECT_EQ(all.max(), left.max());
+}
+
+TEST(integer_histogram, push)
+{
+    integer_histogram hist{};
+    for (uint64_t value : {3, 1, 4, 1, 5})
+        hist.push(value);
+
+    EXPECT_EQ(5u, hist.count());
+    EXPECT_EQ(2u, hist.count(1));
+    EXPECT_EQ(0u, hist.count(2));
+    EXPECT_EQ(0u, hist.count(100));
+    EXPECT_EQ(1u, hist.min());
+    EXPECT_EQ(5u, hist.max());
+    EXPECT_EQ(3u, hist.median());
+    EXPECT_EQ(1u, hist.quantile(0));
+    EXPECT_EQ(5u, hist.quantile(1));
+    EXPECT_NEAR(2.8, hist.mean(), 1e-12);
+    EXPECT_NEAR(2.56, hist.variance(), 1e-12);
+}
+
+TEST(integer_histogram, merge)
+{
+    integer_histogram left{};
+    integer_histogram right{};
+    left.push(2, 3);
+    right.push(7);
+    right.push(0);
+    left.merge(right);
+
+    EXPECT_EQ(5u, left.count());
+    EXPECT_EQ(3u, left.count(2));
+    EXPECT_EQ(0u, left.min());
+    EXPECT_EQ(7u, left.max());
+    EXPECT_EQ(2u, left.median());
+}
+
+TEST(t_digest, small)
+{
+    t_digest digest{};
+    EXPECT_EQ(0.0, digest.median());
+
+    for (double value : {1.0, 2.0, 3.0})
+        digest.push(value);
+    EXPECT_EQ(2.0, digest.median());
+    EXPECT_EQ(1.0, digest.quantile(0));
+    EXPECT_EQ(3.0, digest.quantile(1));
+}
+
+TEST(t_digest, quantiles)
+{
+    std::mt19937_64 engine{42};
+    std::exponential_distribution<double> distribution{1.0};
+    t_digest digest{};
+    t_digest left{};
+    t_digest right{};
+    std::vector<double> sorted{};
+    for (size_t i = 0; i < 100'000; ++i)
+    {
+        double const value = distribution(engine);
+        digest.push(value);
+        (i % 2 ? left : right).push(value);
+        sorted.push_back(value);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    left.merge(right);
+
+    EXPECT_EQ(sorted.front(), digest.quantile(0));
+    EXPECT_EQ(sorted.back(), digest.quantile(1));
+    EXPECT_EQ(100'000.0, left.count());
+    for (double q : {0.01, 0.1, 0.5, 0.9, 0.99})
+    {
+        double const exact = sorted[q * sorted.size()];
+        EXPECT_NEAR(exact, digest.quantile(q), 0.01 * (1 + exact));
+        EXPECT_NEAR(exact, left.quantile(q), 0.01 * (1 + exact));
+    }
+}
+
+TEST(hyperloglog, estimate)
+{
+    hyperloglog empty{};
+    EXPECT_EQ(0.0, empty.estimate());
+
+    hyperloglog small{};
+    for (uint64_t value = 0; value < 100; ++value)
+    {
+        small.push(value);
+        small.push(value);
+    }
+    EXPECT_NEAR(100.0, small.estimate(), 3.0);
+
+    hyperloglog left{};
+    hyperloglog right{};
+    hyperloglog all{};
+    for (uint64_t value = 0; value < 1'000'000; ++value)
+    {
+        all.push(value);
+        (value % 2 ? left : right).push(value);
+        right.push(value % 1000);
+    }
+    left.merge(right);
+    EXPECT_NEAR(1'000'000.0, all.estimate(), 30'000.0);
+    EXPECT_EQ(all.estimate(), left.estimate());
+}
@@ -0,0 +1,121 @@
+#include <forward_list>
+#include <list>
+#include <type_traits>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/io/views/detail/take_until_view.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include <gtest/gtest.h>
+
+#include "../../lib/seqan3/test/unit/range/iterator_test_template.hpp"
+
+#include "syncmer_hash_distance.hpp"
+
+using seqan3::operator""_dna4;
+using result_t = std::vector<size_t>;
+
+using iterator_type = std::ranges::iterator_t<decltype(std::declval<seqan3::dna4_vector&>()
+                                                       | syncmer_hash_distance<true>(2, 5, 0, seqan3::seed{0}))>;
+
+static constexpr auto open_view = syncmer_hash_distance<true>(2, 5, 0, seqan3::seed{0});
+static constexpr auto closed_view = syncmer_hash_distance<false>(2, 5, 0, seqan3::seed{0});
+
+template <>
+struct iterator_fixture<iterator_type> : public ::testing::Test
+{
+    using iterator_tag = std::forward_iterator_tag;
+    static constexpr bool const_iterable = false;
+
+    seqan3::dna4_vector text{"ACGGCGACGTTTAG"_dna4};
+    result_t expected_range{0, 0, 4, 0, 0};
+
+    using test_range_t = decltype(text | open_view);
+    test_range_t test_range = text | open_view;
+};
+
+using test_type = ::testing::Types<iterator_type>;
+INSTANTIATE_TYPED_TEST_SUITE_P(iterator_fixture, iterator_fixture, test_type, );
+
+template <typename T>
+class syncmer_hash_distance_view_properties_test: public ::testing::Test { };
+
+using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                                std::vector<seqan3::dna4> const,
+                                                seqan3::bitpacked_sequence<seqan3::dna4>,
+                                                seqan3::bitpacked_sequence<seqan3::dna4> const,
+                                                std::list<seqan3::dna4>,
+                                                std::list<seqan3::dna4> const>;
+
+TYPED_TEST_SUITE(syncmer_hash_distance_view_properties_test, underlying_range_types, );
+
+class syncmer_hash_distance_test : public ::testing::Test
+{
+protected:
+    std::vector<seqan3::dna4> text1{"AAAAAA"_dna4};
+    result_t result1{0, 0};
+
+    // ACGGC, CGGCG, GGCGA, GCGAC, CGACG, GACGT, ACGTT, CGTTT, GTTTA, TTTAG
+    // open syncmers at 0, 1, 6, 7, 8 and closed syncmers at 0, 1, 3, 6, 7, 8, 9
+    std::vector<seqan3::dna4> text3{"ACGGCGACGTTTAG"_dna4};
+    result_t result3_open{0, 0, 4, 0, 0};
+    result_t result3_closed{0, 0, 1, 2, 0, 0, 0};
+    result_t result3_stop_open{0, 0};
+    result_t result3_stop_closed{0, 0, 1};
+    result_t result3_start_open{0, 0, 0};
+    result_t result3_start_closed{0, 0, 0, 0};
+};
+
+template <typename adaptor_t>
+void compare_types(adaptor_t v)
+{
+    EXPECT_TRUE(std::ranges::input_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::forward_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(v)>);
+    EXPECT_TRUE(std::ranges::view<decltype(v)>);
+    EXPECT_FALSE(std::ranges::sized_range<decltype(v)>);
+    EXPECT_FALSE(std::ranges::common_range<decltype(v)>);
+    EXPECT_TRUE(seqan3::const_iterable_range<decltype(v)>);
+    EXPECT_FALSE((std::ranges::output_range<decltype(v), size_t>));
+}
+
+TYPED_TEST(syncmer_hash_distance_view_properties_test, different_input_ranges)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4,
+                'T'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4}; // ACGTCGACGTTTAG
+    result_t open{0, 0, 4, 0, 0};
+    result_t closed{0, 0, 1, 2, 0, 0, 0};
+    EXPECT_RANGE_EQ(open, text | open_view);
+    EXPECT_RANGE_EQ(closed, text | closed_view);
+}
+
+TEST_F(syncmer_hash_distance_test, open)
+{
+    EXPECT_RANGE_EQ(result1, text1 | open_view);
+    EXPECT_RANGE_EQ(result3_open, text3 | open_view);
+    EXPECT_THROW((text3 | syncmer_hash_distance<true>(6, 5, 0, seqan3::seed{0})), std::invalid_argument);
+}
+
+TEST_F(syncmer_hash_distance_test, closed)
+{
+    EXPECT_RANGE_EQ(result1, text1 | closed_view);
+    EXPECT_RANGE_EQ(result3_closed, text3 | closed_view);
+    EXPECT_THROW((text3 | syncmer_hash_distance<false>(6, 5, 0, seqan3::seed{0})), std::invalid_argument);
+}
+
+TEST_F(syncmer_hash_distance_test, combinability)
+{
+    auto stop_at_t = std::views::take_while([] (seqan3::dna4 const x) { return x != 'T'_dna4; });
+    EXPECT_RANGE_EQ(result3_stop_open, text3 | stop_at_t | open_view);
+    EXPECT_RANGE_EQ(result3_stop_closed, text3 | stop_at_t | closed_view);
+
+    auto start_at_a = std::views::drop(6);
+    EXPECT_RANGE_EQ(result3_start_open, text3 | start_at_a | open_view);
+    EXPECT_RANGE_EQ(result3_start_closed, text3 | start_at_a | closed_view);
+}
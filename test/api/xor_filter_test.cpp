@@ -0,0 +1,57 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "xor_filter.hpp"
+
+TEST(xor_filter, contains)
+{
+    xor_filter filter{{1, 2, 3, 2, 100}, 16};
+    EXPECT_EQ(4u, filter.size());
+    EXPECT_EQ(16u, filter.fingerprint_bits());
+    for (uint64_t value : {1, 2, 3, 100})
+        EXPECT_TRUE(filter.contains(value));
+
+    xor_filter empty{{}, 8};
+    EXPECT_FALSE(empty.contains(0));
+    EXPECT_FALSE(empty.contains(1));
+}
+
+// All values are found and the false positive rate is close to 2^-bits, also for bits, that are not a multiple of 8.
+TEST(xor_filter, false_positive_rate)
+{
+    std::mt19937_64 engine{42};
+    std::vector<uint64_t> values(50'000);
+    for (uint64_t & value : values)
+        value = engine();
+
+    for (size_t bits : {5, 8, 10})
+    {
+        xor_filter filter{values, bits};
+        for (uint64_t value : values)
+            ASSERT_TRUE(filter.contains(value));
+        EXPECT_LT(filter.bytes(), 1.25 * values.size() * bits / 8 + 64);
+
+        size_t false_positives{};
+        size_t const queries{200'000};
+        for (size_t i = 0; i < queries; ++i)
+            false_positives += filter.contains(engine());
+        double const expected = 1.0 / (uint64_t{1} << bits);
+        EXPECT_NEAR(expected, static_cast<double>(false_positives) / queries, 0.25 * expected);
+    }
+}
+
+TEST(binned_xor_filter, bulk_contains)
+{
+    binned_xor_filter filters{70};
+    EXPECT_EQ(70u, filters.bin_count());
+    filters.build(0, {1, 2, 3}, 16);
+    filters.build(1, {3, 4}, 16);
+    filters.build(69, {5}, 16);
+
+    auto agent = filters.membership_agent();
+    EXPECT_EQ((std::vector<uint64_t>{0b01, 0}), agent.bulk_contains(1).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0b11, 0}), agent.bulk_contains(3).raw_data());
+    EXPECT_EQ((std::vector<uint64_t>{0, 0b100000}), agent.bulk_contains(5).raw_data());
+}
@@ -1,3 +1,5 @@
+#include <fstream>
+
 #include "cli_test.hpp"
 
 TEST_F(cli_test, no_options)
@@ -62,6 +64,42 @@ TEST_F(cli_test, opensyncmer)
     EXPECT_EQ(result.err, std::string{});
 }
 
+TEST_F(cli_test, strobemer)
+{
+    // The ibf is built from the randstrobemers of the sequence file, as the ibf in example.ibf has minimisers.
+    cli_test_result result = execute_app("minions accuracy --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --randstrobemers ", data("example1.fasta"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+
+    std::ifstream infile{"randstrobemers_19_2_16_30_search_accuracy.out"};
+    std::string line;
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("randstrobemers_19_2_16_30\t2\t0\t0\t0", line);
+}
+
+TEST_F(cli_test, hybridstrobemer)
+{
+    // The ibf is built from the hybridstrobemers of the sequence file, as the ibf in example.ibf has minimisers.
+    cli_test_result result = execute_app("minions accuracy --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --hybrid ", data("example1.fasta"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+
+    std::ifstream infile{"hybridstrobemers_19_2_16_30_search_accuracy.out"};
+    std::string line;
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ("hybridstrobemers_19_2_16_30\t2\t0\t0\t0", line);
+}
+
+TEST_F(cli_test, thresholds)
+{
+    cli_test_result result = execute_app("minions accuracy --method minimiser -k 19 -w 19 --threshold 0.5 --threshold 0.8 ", data("example.ibf"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
 TEST_F(cli_test, no_ibf_yet)
 {
     cli_test_result result = execute_app("minions accuracy --method minimiser -k 19 -w 19 --ibfsize 10000 ", data("minimiser_hash_19_19_example1.out"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
@@ -84,10 +122,43 @@ TEST_F(cli_test, wrong_method)
     std::string expected
     {
         "Error. Incorrect command line input for accuracy. Validation failed "
-        "for option --method: Value submer is not one of [kmer,minimiser,modmer,syncmer].\n"
+        "for option --method: Value submer is not one of [kmer,minimiser,modmer,strobemer,syncmer].\n"
     };
 
     EXPECT_EQ(result.exit_code, 0);
     EXPECT_EQ(result.err, expected);
     EXPECT_EQ(result.out, std::string{});
 }
+
+TEST_F(cli_test, fpr_out_of_range)
+{
+    std::string expected
+    {
+        "Error. Incorrect command line input for accuracy. The false positive rate must be greater than 0 and "
+        "smaller than 1.\n"
+    };
+    for (std::string fpr : {"0", "1"})
+    {
+        cli_test_result result = execute_app("minions accuracy --method minimiser -k 19 -w 19 --fpr", fpr, data("minimiser_hash_19_19_example1.out"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
+        EXPECT_EQ(result.exit_code, 0);
+        EXPECT_EQ(result.err, expected);
+        EXPECT_EQ(result.out, std::string{});
+    }
+}
+
+TEST_F(cli_test, incompatible_flags)
+{
+    std::vector<std::pair<std::string, std::string>> const cases{
+        {"--exact --blocked", "--blocked and --exact cannot be combined."},
+        {"--hierarchical --xor-filters", "--hierarchical and --xor-filters cannot be combined."},
+        {"--compressed --blocked", "--compressed and --blocked cannot be combined."},
+        {"--ibfsize 10000 --exact", "--ibfsize and --exact cannot be combined."},
+        {"--dedup --hierarchical", "--dedup and --hierarchical cannot be combined."}};
+    for (auto const & [flags, message] : cases)
+    {
+        cli_test_result result = execute_app("minions accuracy --method minimiser -k 19 -w 19", flags, data("minimiser_hash_19_19_example1.out"), "--search-file", data("search.fasta"), "--solution-file", data("expected_search_result.out"));
+        EXPECT_EQ(result.exit_code, 0);
+        EXPECT_EQ(result.err, "Error. Incorrect command line input for accuracy. " + message + "\n");
+        EXPECT_EQ(result.out, std::string{});
+    }
+}
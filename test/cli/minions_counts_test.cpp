@@ -62,6 +62,14 @@ TEST_F(cli_test, minstrobers)
     EXPECT_EQ(result.err, std::string{});
 }
 
+TEST_F(cli_test, minstrobers_order3)
+{
+    cli_test_result result = execute_app("minions counts --method strobemer -k 19 --w-min 16 --w-max 30 --order 3 --minstrobers", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
 TEST_F(cli_test,closedsyncmer)
 {
     cli_test_result result = execute_app("minions counts --method syncmer --closed -t 0 -k 19 -w 3", data("example1.fasta"));
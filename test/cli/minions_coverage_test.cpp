@@ -1,3 +1,5 @@
+#include <fstream>
+
 #include "cli_test.hpp"
 
 TEST_F(cli_test, no_options)
@@ -38,13 +40,116 @@ TEST_F(cli_test, modmer)
     EXPECT_EQ(result.err, std::string{});
 }
 
+TEST_F(cli_test, hybridstrobemer)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --hybrid", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
+TEST_F(cli_test, minstrobers)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --minstrobers", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
+TEST_F(cli_test, minstrobers_order3)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 3 --minstrobers", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
+TEST_F(cli_test, closedsyncmer)
+{
+    cli_test_result result = execute_app("minions coverage --method syncmer --closed -t 0 -k 19 -w 3", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
+TEST_F(cli_test, opensyncmer)
+{
+    cli_test_result result = execute_app("minions coverage --method syncmer -t 0 -k 19 -w 3", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+}
+
+TEST_F(cli_test, multiple_files_threads)
+{
+    cli_test_result result = execute_app("minions coverage --method minimiser -k 19 -w 19 --threads 2", data("example1.fasta"), data("search.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+    EXPECT_TRUE(std::filesystem::exists("minimiser_hash_19_19_coverage.out"));
+    EXPECT_TRUE(std::filesystem::exists("minimiser_hash_19_19_example1_coverage.out"));
+    EXPECT_TRUE(std::filesystem::exists("minimiser_hash_19_19_search_coverage.out"));
+}
+
+TEST_F(cli_test, islands)
+{
+    cli_test_result result = execute_app("minions coverage --method minimiser -k 19 -w 19 --islands --threads 2", data("example1.fasta"), data("search.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+    EXPECT_TRUE(std::filesystem::exists("minimiser_hash_19_19_example1_coverage.out"));
+    EXPECT_TRUE(std::filesystem::exists("minimiser_hash_19_19_search_coverage.out"));
+
+    std::ifstream infile{"minimiser_hash_19_19_coverage.out"};
+    std::string line;
+    ASSERT_TRUE(std::getline(infile, line));
+    EXPECT_EQ(0u, line.find("Covered\tminimiser_hash_19_19\t"));
+}
+
+TEST_F(cli_test, islands_minstrobers)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --minstrobers --islands", data("example1.fasta"));
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.out, std::string{});
+    EXPECT_EQ(result.err, std::string{});
+    EXPECT_TRUE(std::filesystem::exists("minstrobemers_19_2_16_30_coverage.out"));
+}
+
+TEST_F(cli_test, islands_wrong_method)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --hybrid --islands", data("example1.fasta"));
+    std::string expected
+    {
+        "Error. Incorrect command line input for coverage. The islands are only available for minimisers, modmers, "
+        "syncmers and minstrobemers.\n"
+    };
+
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.err, expected);
+    EXPECT_EQ(result.out, std::string{});
+}
+
+TEST_F(cli_test, randstrobemers)
+{
+    cli_test_result result = execute_app("minions coverage --method strobemer -k 19 --w-min 16 --w-max 30 --order 2 --randstrobemers", data("example1.fasta"));
+    std::string expected
+    {
+        "Error. Incorrect command line input for coverage. The coverage of strobemers is only available for "
+        "hybridstrobemers and minstrobemers.\n"
+    };
+
+    EXPECT_EQ(result.exit_code, 0);
+    EXPECT_EQ(result.err, expected);
+    EXPECT_EQ(result.out, std::string{});
+}
+
 TEST_F(cli_test, wrong_method)
 {
     cli_test_result result = execute_app("minions coverage --method submer -k 19", data("example1.fasta"));
     std::string expected
     {
         "Error. Incorrect command line input for coverage. Validation failed "
-        "for option --method: Value submer is not one of [kmer,minimiser,modmer].\n"
+        "for option --method: Value submer is not one of [kmer,minimiser,modmer,strobemer,syncmer].\n"
     };
 
     EXPECT_EQ(result.exit_code, 0);